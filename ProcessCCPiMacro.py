@@ -25,7 +25,7 @@ kMC_INPUTS_MACRO = "xsec/makeCrossSectionMCInputs.C+"
 kBACKGROUND_BREAKDOWN = "studies/runBackgrounds.C+"
 # Grid Stuff
 kMINERVA_RELEASE = os.getenv("MINERVA_RELEASE")
-kMEMORY = "8GB"
+kMEMORY_MB = 8000  # per event loop thread
 kGRID_OPTIONS = (
     "--group minerva "
     "--resource-provides=usage_model=DEDICATED,OPPORTUNISTIC "
@@ -124,6 +124,16 @@ def MakeTarfile(source_dir, tag):
     return tarfile_name, tarfile_fullpath
 
 
+# "8GB", "8000MB", or "8000" (MB) --> 8000
+def GetMemoryMB(memory):
+    memory = str(memory).upper()
+    if memory.endswith("GB"):
+        return int(float(memory[:-2]) * 1000)
+    if memory.endswith("MB"):
+        memory = memory[:-2]
+    return int(float(memory))
+
+
 def MakeUniqueProcessingID(tag):
     processing_id = "{TAG}{DAY}-{TIME}".format(
         TAG=tag, DAY=dt.date.today(), TIME=dt.datetime.today().strftime("%H%M%S")
@@ -139,7 +149,13 @@ def GetOptions():
     grid_group.add_option("--out_dir", default=kOUTDIR, help="Default = %default.")
     grid_group.add_option("--filetag", default=kFILETAG)
     grid_group.add_option("--tarfile", default="")
-    grid_group.add_option("--memory", default=kMEMORY)
+    grid_group.add_option(
+        "--memory",
+        default="",
+        help="Job memory request, e.g. 8GB. Default: {0}MB per --threads.".format(
+            kMEMORY_MB
+        ),
+    )
     grid_group.add_option("--ev_sel", action="store_true")
     grid_group.add_option("--mc_xsec_inputs", action="store_true")
     grid_group.add_option("--bg_breakdown", action="store_true")
@@ -179,6 +195,11 @@ def GetOptions():
         help="ALL, or ME1A, etc. Maybe a list someday but not now.",
     )
     job_group.add_option("--run", default=[], help="Specify a specific run number")
+    job_group.add_option(
+        "--threads",
+        default=1,
+        help="Worker threads for the MC xsec inputs event loop. Default: %default.",
+    )
 
     parser.add_option_group(grid_group)
     parser.add_option_group(job_group)
@@ -201,6 +222,14 @@ def GetOptions():
     else:
         pass
 
+    # Each MC xsec inputs thread holds its own copy of the hists, so the
+    # default request scales with the threads
+    n_threads = int(options.threads) if options.mc_xsec_inputs else 1
+    options.cpu = n_threads
+    options.memory_mb = (
+        GetMemoryMB(options.memory) if options.memory else kMEMORY_MB * n_threads
+    )
+
     # fix file tag underscore
     if options.filetag != kFILETAG and not options.filetag[:1] == "_":
         options.filetag = "_" + options.filetag
@@ -278,7 +307,8 @@ def main():
                 macro = options.macro
                 macro += (
                     '({SIGNAL_DEFINITION},\\\\\\"{PLAYLIST}\\\\\\",{DO_FULL_SYST},'
-                    '{DO_TRUTH},{DO_TEST},{DO_GRID},\\\\\\"{TUPLE}\\\\\\",{RUN})'.format(
+                    '{DO_TRUTH},{DO_TEST},{DO_GRID},\\\\\\"{TUPLE}\\\\\\",{RUN},'
+                    "{N_THREADS})".format(
                         SIGNAL_DEFINITION=options.signal_definition,
                         PLAYLIST=i_playlist,
                         DO_FULL_SYST="true" if options.do_full_systematics else "false",
@@ -287,6 +317,7 @@ def main():
                         DO_GRID="true",
                         TUPLE=anatuple,
                         RUN=run,
+                        N_THREADS=options.threads,
                     )
                 )
 
@@ -309,17 +340,21 @@ def main():
 
             # Prepare Submit Command
             submit_command = (
-                "jobsub_submit {GRID} --memory {MEMORY} --expected-lifetime=24h "
+                "jobsub_submit {GRID} --memory {MEMORY} --cpu {CPU} "
+                "--expected-lifetime=24h "
                 "-d OUT {OUTDIR} "
                 "-L {LOGFILE} "
                 "-e MACRO={MACRO} "
+                "-e CCPI_MEMORY_MB={MEMORY_MB} "
                 "-e TARFILE={TARFILE} "
                 "-f dropbox://{TARFILE_FULLPATH} "
                 #                "--tar_file_name dropbox://{TARFILE_FULLPATH} "
                 "--use-pnfs-dropbox "
                 "file://{GRID_SCRIPT}".format(
                     GRID=kGRID_OPTIONS,
-                    MEMORY=options.memory,
+                    MEMORY="{0}MB".format(options.memory_mb),
+                    MEMORY_MB=options.memory_mb,
+                    CPU=options.cpu,
                     OUTDIR=out_dir,
                     LOGFILE=out_dir + "/log{0}.txt".format(run),
                     MACRO=macro,
@@ -0,0 +1,82 @@
+#ifndef Bootstrap_h
+#define Bootstrap_h
+
+//==============================================================================
+// Poisson bootstrap universes, for the MC's statistical uncertainty.
+//
+// Each universe of the MC_Stat_Bootstrap band weights every event by its own
+// Poisson(1) draw, on top of the CV's weight. The spread of the universes is
+// then the MC's statistical covariance, event by event, for every hist that
+// the loop fills: selection, migration, effnum and effden alike.
+//
+// The draws come from counter_rng, keyed on the event and streamed by the
+// universe's index, so an event gets the same draws in the reco and truth
+// loops, in any shard or thread, and in any job that processes it.
+//==============================================================================
+#include <cmath>  // exp
+#include <cstdint>
+#include <string>
+
+#include "CVUniverse.h"
+#include "Constants.h"  // typedef UniverseMap
+#include "CounterRNG.h"
+#include "PlotUtils/ChainWrapper.h"
+
+namespace bootstrap {
+const std::string kBandName = "MC_Stat_Bootstrap";
+
+using counter_rng::GetEventKey;
+
+// Poisson(1) draw of universe i for the event with key, by inversion of a
+// uniform in [0, 1)
+inline int GetPoissonWeight(const uint64_t key, const int i) {
+  const double u = counter_rng::Uniform(key, uint64_t(i));
+  double p = std::exp(-1.);
+  double cdf = p;
+  int n = 0;
+  while (u >= cdf && p > 0.) {
+    ++n;
+    p /= n;
+    cdf += p;
+  }
+  return n;
+}
+
+class BootstrapUniverse : public CVUniverse {
+ public:
+  BootstrapUniverse(PlotUtils::ChainWrapper* chw, const int index)
+      : CVUniverse(chw), m_index(index) {}
+
+  int Index() const { return m_index; }
+
+  virtual double GetWeight() const /*override*/ {
+    return CVUniverse::GetWeight() *
+           GetPoissonWeight(GetEventKey(*this), m_index);
+  }
+
+  virtual std::string ShortName() const /*override*/ { return kBandName; }
+  virtual std::string LatexName() const /*override*/ {
+    return "MC Statistics (bootstrap)";
+  }
+  virtual bool IsVerticalOnly() const /*override*/ { return true; }
+
+ private:
+  int m_index;
+};
+
+// Give error_bands a band of n_universes bootstrap universes
+inline void AddBootstrapUniverses(UniverseMap& error_bands,
+                                  PlotUtils::ChainWrapper* chain,
+                                  const int n_universes) {
+  for (int i = 0; i < n_universes; ++i)
+    error_bands[kBandName].push_back(new BootstrapUniverse(chain, i));
+}
+
+// Number of bootstrap universes in error_bands
+inline int GetNUniverses(const UniverseMap& error_bands) {
+  auto band = error_bands.find(kBandName);
+  return band == error_bands.end() ? 0 : band->second.size();
+}
+}  // namespace bootstrap
+
+#endif  // Bootstrap_h
@@ -0,0 +1,137 @@
+#ifndef BranchHandle_h
+#define BranchHandle_h
+
+//==============================================================================
+// Pre-resolved tuple branches.
+//
+// namespace branches { const BranchHandle kPionPx("MasterAnaDev_pion_Px"); }
+// double px = universe.Read(branches::kPionPx, hadron);
+//
+// GetDouble("name"), GetVecElem("name", i), ... look the branch up by name on
+// every call. A BranchHandle gets a slot number once, when it's made. Each
+// chain's BranchRegistry resolves the slot to the branch's TLeaf once per tree
+// of the chain, so a read is an index into a vector and the leaf's value.
+//
+// Values are the same as GetVecElem's. A registry belongs to one chain, and
+// like the chain, is used by one thread at a time. It lives as long as the
+// universes that read through it.
+//==============================================================================
+#include <cstdlib>  // exit
+#include <iostream>
+#include <iterator>  // next
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "PlotUtils/ChainWrapper.h"
+#include "TBranch.h"
+#include "TChain.h"
+#include "TLeaf.h"
+
+class BranchHandle {
+ public:
+  explicit BranchHandle(const char* name)
+      : m_name(name), m_slot(NextSlot()) {}
+  const std::string& Name() const { return m_name; }
+  int Slot() const { return m_slot; }
+
+ private:
+  // Handles are made during static initialization, one thread
+  static int NextSlot() {
+    static int n_slots = 0;
+    return n_slots++;
+  }
+  const std::string m_name;
+  const int m_slot;
+};
+
+class BranchRegistry {
+ public:
+  explicit BranchRegistry(TChain* chain) : m_chain(chain) {}
+
+  TChain* GetChain() const { return m_chain; }
+
+  double Get(const BranchHandle& handle, const Long64_t entry,
+             const int i = 0) {
+    return GetEntryLeaf(handle, entry)->GetValue(i);
+  }
+
+  // Number of elements of an array branch at entry
+  int GetLength(const BranchHandle& handle, const Long64_t entry) {
+    return GetEntryLeaf(handle, entry)->GetLen();
+  }
+
+ private:
+  struct Leaf {
+    TLeaf* leaf = nullptr;
+    TBranch* branch = nullptr;
+    int tree_number = -1;
+  };
+
+  // The handle's leaf, with entry read in
+  TLeaf* GetEntryLeaf(const BranchHandle& handle, const Long64_t entry) {
+    const Long64_t local_entry = m_chain->LoadTree(entry);
+    if (local_entry < 0) {
+      std::cerr << "BranchRegistry: can't load entry " << entry << " of "
+                << m_chain->GetName() << "\n";
+      std::exit(1);
+    }
+    const Leaf& leaf = GetLeaf(handle);
+    if (leaf.branch->GetReadEntry() != local_entry)
+      leaf.branch->GetEntry(local_entry);
+    return leaf.leaf;
+  }
+
+  const Leaf& GetLeaf(const BranchHandle& handle) {
+    if (handle.Slot() >= int(m_leaves.size()))
+      m_leaves.resize(handle.Slot() + 1);
+    Leaf& leaf = m_leaves[handle.Slot()];
+    if (leaf.tree_number != m_chain->GetTreeNumber()) Resolve(handle, leaf);
+    return leaf;
+  }
+
+  void Resolve(const BranchHandle& handle, Leaf& leaf) {
+    TTree* tree = m_chain->GetTree();
+    leaf.leaf = tree ? tree->GetLeaf(handle.Name().c_str()) : nullptr;
+    if (!leaf.leaf) {
+      std::cerr << "BranchRegistry: no branch " << handle.Name() << " in "
+                << m_chain->GetName() << "\n";
+      std::exit(1);
+    }
+    leaf.branch = leaf.leaf->GetBranch();
+    if (leaf.branch->TestBit(TBranch::kDoNotProcess)) {
+      std::cerr << "BranchRegistry: branch " << handle.Name()
+                << " is inactive. Is it missing from the branch list?\n";
+      std::exit(1);
+    }
+    leaf.tree_number = m_chain->GetTreeNumber();
+  }
+
+  TChain* m_chain;
+  std::vector<Leaf> m_leaves;  // by handle slot
+};
+
+// The registry of chw's chain, made on first use. Universes of the same chain
+// share it, and own it: the map only remembers it while they're alive. So a
+// shard's chain, deleted along with its universes, takes its registry with it,
+// and a chain allocated later at the same address gets a new one.
+inline std::shared_ptr<BranchRegistry> GetBranchRegistry(
+    PlotUtils::ChainWrapper* chw) {
+  static std::mutex mutex;
+  static std::map<PlotUtils::ChainWrapper*, std::weak_ptr<BranchRegistry>>
+      registries;
+  std::lock_guard<std::mutex> lock(mutex);
+  // Forget the registries of deleted universes' chains
+  for (auto it = registries.begin(); it != registries.end();)
+    it = it->second.expired() ? registries.erase(it) : std::next(it);
+  std::shared_ptr<BranchRegistry> registry = registries[chw].lock();
+  if (!registry || registry->GetChain() != chw->GetChain()) {
+    registry = std::make_shared<BranchRegistry>(chw->GetChain());
+    registries[chw] = registry;
+  }
+  return registry;
+}
+
+#endif  // BranchHandle_h
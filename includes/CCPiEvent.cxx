@@ -3,8 +3,12 @@
 
 #include "CCPiEvent.h"
 
+#include <cassert>
+#include <map>
+
 #include "Cuts.h"    // kCutsVector
 #include "Michel.h"  // class endpoint::Michel, typdef endpoint::MichelMap, endpoint::GetQualityMichels
+#include "Timing.h"  // timing::ScopedTimer
 #include "common_functions.h"  // GetVar, HasVar
 
 //==============================================================================
@@ -25,13 +29,29 @@ CCPiEvent::CCPiEvent(const bool is_mc, const bool is_truth,
                      : kNWSidebandTypes),
       m_weight(is_mc ? universe->GetWeight() : 1.) {}
 
+CCPiEvent::CCPiEvent(const bool is_mc, const bool is_truth,
+                     const SignalDefinition signal_definition,
+                     CVUniverse* universe, const bool is_signal,
+                     const WSidebandType w_type)
+    : m_is_mc(is_mc),
+      m_is_truth(is_truth),
+      m_signal_definition(signal_definition),
+      m_universe(universe),
+      m_reco_pion_candidate_idxs(),
+      m_is_signal(is_signal),
+      m_w_type(w_type),
+      m_weight(0.),
+      m_highest_energy_pion_idx(-300) {}
+
 //==============================================================================
 // Helper Functions
 //==============================================================================
 // PassesCutsInfo {passes_all_cuts, is_w_sideband, passes_all_except_w,
 // pion_candidate_idxs}
-PassesCutsInfo PassesCuts(const CCPiEvent& e) {
-  return PassesCuts(*e.m_universe, e.m_is_mc, e.m_signal_definition);
+PassesCutsInfo PassesCuts(const CCPiEvent& e,
+                          const bool need_pion_candidates) {
+  return PassesCuts(*e.m_universe, e.m_is_mc, e.m_signal_definition,
+                    kCutsVector, need_pion_candidates);
 }
 
 SignalBackgroundType GetSignalBackgroundType(const CCPiEvent& e) {
@@ -56,120 +76,150 @@ endpoint::MichelMap GetTrackedPionCandidates(const CCPiEvent& e) {
 
   // Remove michels if their associated pion track fails cuts
 
-  // Basic hadron track quality
-  ContainerEraser::erase_if(
-      michels, [&univ](std::pair<int, endpoint::Michel> mm) {
-        return !HadronQualityCuts(univ, mm.second.had_idx);
-      });
+  // In one pass:
+  // * Basic hadron track quality
+  // * LLR -- proton vs pion separation PID score
+  // * Node cut -- remove interacting pions (which have bad tpi reco)
+  michels.EraseIf([&univ](const endpoint::Michel& m) {
+    return !PassesHadronCut(univ, hadron_quality::kTrackQuality, m.had_idx) ||
+           !PassesHadronCut(univ, hadron_quality::kLLR, m.had_idx) ||
+           !PassesHadronCut(univ, hadron_quality::kNode, m.had_idx);
+  });
 
-  // LLR -- proton vs pion separation PID score
-  ContainerEraser::erase_if(michels,
-                            [&univ](std::pair<int, endpoint::Michel> mm) {
-                              return !LLRCut(univ, mm.second.had_idx);
-                            });
+  return michels;
+}
 
-  // Node cut -- remove interacting pions (which have bad tpi reco)
-  ContainerEraser::erase_if(michels,
-                            [&univ](std::pair<int, endpoint::Michel> mm) {
-                              return !NodeCut(univ, mm.second.had_idx);
-                            });
+//==============================================================================
+// Fill plan
+//==============================================================================
+namespace ccpi_event {
+namespace {
+EPionRole GetPionRole(const std::string& name) {
+  if (name == "tpi" || name == "thetapi_deg") return kTrackedPion;
+  if (name == "mtpi" || name == "mthetapi_deg") return kUntrackedPion;
+  if (name == "bkdtrackedtpi") return kBkdTracked;
+  if (name == "bkdtracklesstpi") return kBkdTrackless;
+  if (name == "bkdmixtpi") return kBkdMixed;
+  return kAnyPion;
+}
 
-  return michels;
+EAaronRole GetAaronRole(const std::string& name) {
+  if (name == "mixtpi_Aaron" || name == "q2_Aaron" ||
+      name == "mixtpi_Aaron_true" || name == "q2_Aaron_true")
+    return kAaronOnly;
+  if (name == "mixtpi_NoAaron" || name == "q2_NoAaron" ||
+      name == "mixtpi_NoAaron_true" || name == "q2_NoAaron_true")
+    return kNoAaronOnly;
+  return kNoAaronSplit;
+}
+
+// Is a variable with this role filled for an event passing the tracked
+// and/or trackless cuts?
+bool PassesPionRole(const EPionRole role, const bool tracked,
+                    const bool trackless) {
+  switch (role) {
+    case kTrackedPion:
+      return tracked;
+    case kUntrackedPion:
+      return trackless;
+    case kBkdTracked:
+      return !trackless;
+    case kBkdTrackless:
+      return !tracked;
+    case kBkdMixed:
+      return tracked == trackless;
+    default:
+      return true;
+  }
+}
+
+// Is a variable with this role filled for an event in (or out of) Aaron's
+// phase space?
+bool PassesAaronRole(const EAaronRole role, const bool in_aaron) {
+  switch (role) {
+    case kAaronOnly:
+      return in_aaron;
+    case kNoAaronOnly:
+      return !in_aaron;
+    default:
+      return true;
+  }
+}
+
+bool IsInAaronPhaseSpace(const CVUniverse& universe, const RecoPionIdx idx) {
+  return universe.GetThetamu() < 0.226892803 && universe.GetMixedTpi(idx) > 35.;
+}
+
+bool IsInAaronPhaseSpaceTrue(const CVUniverse& universe,
+                             const TruePionIdx idx) {
+  return universe.GetThetamuTrue() < 0.226892803 &&
+         universe.GetMixedTpiTrue(idx) > 35.;
+}
+}  // namespace
+}  // namespace ccpi_event
+
+ccpi_event::FillPlan ccpi_event::MakeFillPlan(
+    const std::vector<Variable*>& variables) {
+  FillPlan plan;
+  plan.variables = variables;
+  plan.sideband_fit_var = -1;
+
+  // First variable of each name, like GetVar
+  std::map<std::string, int> index;
+  for (int i = 0; i < (int)variables.size(); ++i) {
+    Variable* var = variables[i];
+    const std::string name = var->Name();
+    index.insert({name, i});
+    plan.infos.push_back({var, GetPionRole(name), GetAaronRole(name)});
+    if (name == sidebands::kFitVarString && plan.sideband_fit_var < 0)
+      plan.sideband_fit_var = i;
+  }
+
+  for (auto name : kMigrationVars) {
+    auto reco = index.find(name);
+    auto truth = index.find(name + "_true");
+    if (reco != index.end() && truth != index.end())
+      plan.migration_pairs.push_back({reco->second, truth->second});
+  }
+  return plan;
 }
 
 //==============================================================================
 // Fill all histos for an entire event -- call other specialized fill functions
 //==============================================================================
-void ccpi_event::FillRecoEvent(const CCPiEvent& event,
-                               const std::vector<Variable*>& variables) {
+void ccpi_event::FillRecoEvent(const CCPiEvent& event, const FillPlan& plan) {
   // Fill selection -- total, signal-only, and bg-only
   if (event.m_passes_cuts || event.m_passes_trackless_cuts) {
-    ccpi_event::FillSelected(event, variables);
+    ccpi_event::FillSelected(event, plan);
   }
   // Fill W Sideband
   if ((event.m_is_w_sideband || event.m_passes_trackless_sideband) &&
       !(event.m_passes_cuts || event.m_passes_trackless_cuts)) {
-    ccpi_event::FillWSideband(event, variables);
+    ccpi_event::FillWSideband(event, plan);
   }
 
   // Fill W Sideband Study
   if ((event.m_passes_all_cuts_except_w ||
        event.m_passes_trackless_cuts_except_w) &&
       event.m_universe->ShortName() == "cv") {
-    ccpi_event::FillWSideband_Study(event, variables);
+    ccpi_event::FillWSideband_Study(event, plan.variables);
   }
 
   // Fill Migration
   if (event.m_is_mc && event.m_is_signal &&
       (event.m_passes_cuts || event.m_passes_trackless_cuts)) {
-    if (HasVar(variables, "tpi") && HasVar(variables, "tpi_true"))
-      FillMigration(event, variables, std::string("tpi"));
-    if (HasVar(variables, "thetapi_deg") &&
-        HasVar(variables, "thetapi_deg_true"))
-      FillMigration(event, variables, std::string("thetapi_deg"));
-    if (HasVar(variables, "pmu") && HasVar(variables, "pmu_true"))
-      FillMigration(event, variables, std::string("pmu"));
-    if (HasVar(variables, "pzmu") && HasVar(variables, "pzmu_true"))
-      FillMigration(event, variables, std::string("pzmu"));
-    if (HasVar(variables, "ptmu") && HasVar(variables, "ptmu_true"))
-      FillMigration(event, variables, std::string("ptmu"));
-    if (HasVar(variables, "thetamu_deg") &&
-        HasVar(variables, "thetamu_deg_true"))
-      FillMigration(event, variables, std::string("thetamu_deg"));
-    if (HasVar(variables, "q2") && HasVar(variables, "q2_true"))
-      FillMigration(event, variables, std::string("q2"));
-    if (HasVar(variables, "q2_Aaron") && HasVar(variables, "q2_Aaron_true"))
-      FillMigration(event, variables, std::string("q2_Aaron"));
-    if (HasVar(variables, "q2_NoAaron") && HasVar(variables, "q2_NoAaron_true"))
-      FillMigration(event, variables, std::string("q2_NoAaron"));
-    if (HasVar(variables, "enu") && HasVar(variables, "enu_true"))
-      FillMigration(event, variables, std::string("enu"));
-    if (HasVar(variables, "wexp") && HasVar(variables, "wexp_true"))
-      FillMigration(event, variables, std::string("wexp"));
-    if (HasVar(variables, "ehad") && HasVar(variables, "ehad_true"))
-      FillMigration(event, variables, std::string("ehad"));
-    if (HasVar(variables, "cosadtheta") && HasVar(variables, "cosadtheta_true"))
-      FillMigration(event, variables, std::string("cosadtheta"));
-    if (HasVar(variables, "adphi") && HasVar(variables, "adphi_true"))
-      FillMigration(event, variables, std::string("adphi"));
-    if (HasVar(variables, "pimuAngle") && HasVar(variables, "pimuAngle_true"))
-      FillMigration(event, variables, std::string("pimuAngle"));
-    if (HasVar(variables, "PT") && HasVar(variables, "PT_true"))
-      FillMigration(event, variables, std::string("PT"));
-    if (HasVar(variables, "mtpi") && HasVar(variables, "mtpi_true"))
-      FillMigration(event, variables, std::string("mtpi"));
-    if (HasVar(variables, "mixtpi") && HasVar(variables, "mixtpi_true"))
-      FillMigration(event, variables, std::string("mixtpi"));
-    if (HasVar(variables, "mixtpi_Aaron") &&
-        HasVar(variables, "mixtpi_Aaron_true"))
-      FillMigration(event, variables, std::string("mixtpi_Aaron"));
-    if (HasVar(variables, "mixtpi_NoAaron") &&
-        HasVar(variables, "mixtpi_NoAaron_true"))
-      FillMigration(event, variables, std::string("mixtpi_NoAaron"));
-    if (HasVar(variables, "bkdtrackedtpi") &&
-        HasVar(variables, "bkdtrackedtpi_true"))
-      FillMigration(event, variables, std::string("bkdtrackedtpi"));
-    if (HasVar(variables, "bkdtracklesstpi") &&
-        HasVar(variables, "bkdtracklesstpi_true"))
-      FillMigration(event, variables, std::string("bkdtracklesstpi"));
-    if (HasVar(variables, "bkdmixtpi") && HasVar(variables, "bkdmixtpi_true"))
-      FillMigration(event, variables, std::string("bkdmixtpi"));
-    if (HasVar(variables, "mthetapi_deg") &&
-        HasVar(variables, "mthetapi_deg_true"))
-      FillMigration(event, variables, std::string("mthetapi_deg"));
-    if (HasVar(variables, "mixthetapi_deg") &&
-        HasVar(variables, "mixthetapi_deg_true"))
-      FillMigration(event, variables, std::string("mixthetapi_deg"));
+    for (const auto& pair : plan.migration_pairs)
+      FillMigration(event, plan.infos[pair.first],
+                    plan.variables[pair.second]);
   }
 }
 
-void ccpi_event::FillTruthEvent(const CCPiEvent& event,
-                                const std::vector<Variable*>& variables) {
+void ccpi_event::FillTruthEvent(const CCPiEvent& event, const FillPlan& plan) {
   // Fill Efficiency Denominator
   if (event.m_is_signal) {
     //    if (event.m_universe->ShortName() == "cv")
     //    ccpi_event::FillStackedHists(event, variables);
-    ccpi_event::FillEfficiencyDenominator(event, variables);
+    ccpi_event::FillEfficiencyDenominator(event, plan);
   }
 }
 
@@ -180,9 +230,42 @@ void ccpi_event::FillTruthEvent(const CCPiEvent& event,
 // ** sig + bg (true and reco vars, data and mc)
 // ** signal only (true vars, for eff num & closure)
 // ** bg only (reco and true vars)
-void ccpi_event::FillSelected(const CCPiEvent& event,
-                              const std::vector<Variable*>& variables) {
-  for (auto var : variables) {
+// Whether var gets filled for this selected event, and with what value.
+// Shared by FillSelected and FillSelectedVertical.
+bool ccpi_event::GetSelectedFillValue(const CCPiEvent& event,
+                                      const VariableFillInfo& info,
+                                      double& fill_val) {
+  const Variable* var = info.var;
+  if (!PassesPionRole(info.pion_role, event.m_passes_cuts,
+                      event.m_passes_trackless_cuts))
+    return false;
+
+  // Get fill value
+  if (var->m_is_true) {
+    TruePionIdx idx = GetHighestEnergyTruePionIndex(event);
+    fill_val = var->GetValue(*event.m_universe, idx);
+    // These conditions are to fill the breakdown of the events that pass
+    // the Aaron's cuts and which are not passing the Aaron's cuts
+    if (info.aaron_role != kNoAaronSplit &&
+        !PassesAaronRole(info.aaron_role,
+                         IsInAaronPhaseSpaceTrue(*event.m_universe, idx)))
+      return false;
+  } else {
+    // RecoPionIdx idx = GetHighestEnergyPionCandidateIndex(event);
+    RecoPionIdx idx = event.m_highest_energy_pion_idx;
+    fill_val = var->GetValue(*event.m_universe, idx);
+    if (info.aaron_role != kNoAaronSplit &&
+        !PassesAaronRole(info.aaron_role,
+                         IsInAaronPhaseSpace(*event.m_universe, idx)))
+      return false;
+  }
+
+  return true;
+}
+
+void ccpi_event::FillSelected(const CCPiEvent& event, const FillPlan& plan) {
+  for (const auto& info : plan.infos) {
+    Variable* var = info.var;
     // Sanity Checks
     if (var->m_is_true && !event.m_is_mc) return;  // truth, but not MC?
     /*    if (event.m_reco_pion_candidate_idxs.empty()) {
@@ -190,61 +273,8 @@ void ccpi_event::FillSelected(const CCPiEvent& event,
           std::exit(1);
         }*/
 
-    if (var->Name() == "bkdtrackedtpi" &&
-        ((!event.m_passes_cuts && event.m_passes_trackless_cuts) ||
-         (event.m_passes_cuts && event.m_passes_trackless_cuts)))
-      continue;
-
-    if (var->Name() == "bkdtracklesstpi" &&
-        ((event.m_passes_cuts && !event.m_passes_trackless_cuts) ||
-         (event.m_passes_cuts && event.m_passes_trackless_cuts)))
-      continue;
-
-    if (var->Name() == "bkdmixtpi" &&
-        ((!event.m_passes_cuts && event.m_passes_trackless_cuts) ||
-         (event.m_passes_cuts && !event.m_passes_trackless_cuts)))
-      continue;
-
-    if (var->Name() == "tpi" && !event.m_passes_cuts) continue;
-
-    if (var->Name() == "thetapi_deg" && !event.m_passes_cuts) continue;
-
-    if (var->Name() == "mthetapi_deg" && !event.m_passes_trackless_cuts)
-      continue;
-
-    if (var->Name() == "mtpi" && !event.m_passes_trackless_cuts) continue;
-
-    // Get fill value
     double fill_val = -999.;
-    if (var->m_is_true) {
-      TruePionIdx idx = GetHighestEnergyTruePionIndex(event);
-      fill_val = var->GetValue(*event.m_universe, idx);
-      if (event.m_universe->GetThetamuTrue() < 0.226892803 &&
-          event.m_universe->GetMixedTpiTrue(idx) > 35.) {
-        if (var->Name() == "mixtpi_NoAaron_true" ||
-            var->Name() == "q2_NoAaron_true")
-          continue;
-      } else {
-        if (var->Name() == "mixtpi_Aaron_true" ||
-            var->Name() == "q2_Aaron_true")
-          continue;
-      }
-    } else {
-      // RecoPionIdx idx = GetHighestEnergyPionCandidateIndex(event);
-      RecoPionIdx idx = event.m_highest_energy_pion_idx;
-      fill_val = var->GetValue(*event.m_universe, idx);
-      // These conditions are to fill the breakdown of the events that pass
-      // the Aaron's cuts and which are not passing the Aaron's cuts
-
-      if (event.m_universe->GetThetamu() < 0.226892803 &&
-          event.m_universe->GetMixedTpi(idx) > 35.) {
-        if (var->Name() == "mixtpi_NoAaron" || var->Name() == "q2_NoAaron")
-          continue;
-      } else {
-        if (var->Name() == "mixtpi_Aaron" || var->Name() == "q2_Aaron")
-          continue;
-      }
-    }
+    if (!GetSelectedFillValue(event, info, fill_val)) continue;
 
     // total = signal & background, together
     if (event.m_is_mc) {
@@ -324,14 +354,50 @@ void ccpi_event::FillSelected(const CCPiEvent& event,
   }  // end variables
 }
 
+// Whether var gets filled for this sideband event, and with what value.
+// Shared by FillWSideband and FillWSidebandVertical.
+bool ccpi_event::GetWSidebandFillValue(const CCPiEvent& event,
+                                       const VariableFillInfo& info,
+                                       double& fill_val) {
+  const Variable* var = info.var;
+  const RecoPionIdx idx = event.m_highest_energy_pion_idx;
+
+  // if (var->m_is_true && !event.m_is_mc) return false; // truth, not MC?
+  // truth pion variables don't generally work
+  if (var->m_is_true) return false;
+
+  // Tracked pion variables need the tracked sideband, the others the
+  // trackless sideband
+  switch (info.pion_role) {
+    case kTrackedPion:
+    case kBkdTracked:
+      if (!event.m_is_w_sideband) return false;
+      break;
+    case kUntrackedPion:
+    case kBkdTrackless:
+    case kBkdMixed:
+      if (!event.m_passes_trackless_sideband) return false;
+      break;
+    default:
+      break;
+  }
+
+  if (info.aaron_role != kNoAaronSplit &&
+      !PassesAaronRole(info.aaron_role,
+                       IsInAaronPhaseSpace(*event.m_universe, idx)))
+    return false;
+
+  fill_val = var->GetValue(*event.m_universe, idx);
+  return true;
+}
+
 // Fill histograms of all variables with events in the sideband region
-void ccpi_event::FillWSideband(const CCPiEvent& event,
-                               const std::vector<Variable*>& variables) {
+void ccpi_event::FillWSideband(const CCPiEvent& event, const FillPlan& plan) {
   /*  if (!event.m_is_w_sideband || !event.m_passes_trackless_sideband) {
       std::cerr << "FillWSideband Warning: This event is not in the wsideband "
                    "region, are you sure you want to be filling?\n";
     }*/
-  if (!HasVar(variables, sidebands::kFitVarString)) {
+  if (plan.sideband_fit_var < 0) {
     std::cerr << "FillWSideband: variables container is missing fit var\n";
     std::exit(1);
   }
@@ -340,37 +406,10 @@ void ccpi_event::FillWSideband(const CCPiEvent& event,
    //   std::exit(1);
     }*/
 
-  const RecoPionIdx idx = event.m_highest_energy_pion_idx;
-
-  for (auto var : variables) {
-    // if (var->m_is_true && !event.m_is_mc) continue; // truth, but not MC?
-    if (var->m_is_true) continue;  // truth pion variables don't generally work
-    if ((var->Name() == "mthetapi_deg") && !event.m_passes_trackless_sideband)
-      continue;
-
-    if (var->Name() == "mtpi" && !event.m_passes_trackless_sideband) continue;
-
-    if (var->Name() == "bkdtrackedtpi" && !event.m_is_w_sideband) continue;
-
-    if (var->Name() == "bkdtracklesstpi" && !event.m_passes_trackless_sideband)
-      continue;
-
-    if (var->Name() == "bkdmixtpi" && !event.m_passes_trackless_sideband)
-      continue;
-
-    if (var->Name() == "tpi" && !event.m_is_w_sideband) continue;
-
-    if (var->Name() == "thetapi_deg" && !event.m_is_w_sideband) continue;
-
-    if (event.m_universe->GetThetamu() < 0.226892803 &&
-        event.m_universe->GetMixedTpi(idx) > 35.) {
-      if (var->Name() == "mixtpi_NoAaron" || var->Name() == "q2_NoAaron")
-        continue;
-    } else {
-      if (var->Name() == "mixtpi_Aaron" || var->Name() == "q2_Aaron") continue;
-    }
-
-    const double fill_val = var->GetValue(*event.m_universe, idx);
+  for (const auto& info : plan.infos) {
+    Variable* var = info.var;
+    double fill_val = -999.;
+    if (!GetWSidebandFillValue(event, info, fill_val)) continue;
     //   if (var->Name() == "wexp" && fill_val < 1500)std::cout <<
     //   "FillWSideband W = " << fill_val << "\n";
     if (event.m_is_mc) {
@@ -401,75 +440,69 @@ void ccpi_event::FillWSideband(const CCPiEvent& event,
   }  // end variables
 }
 
-void ccpi_event::FillMigration(const CCPiEvent& event,
-                               const vector<Variable*>& variables,
-                               std::string name) {
-  Variable* reco_var = GetVar(variables, name);
-  Variable* true_var = GetVar(variables, name + string("_true"));
-  if (true_var == 0) return;
-
-  if (name == "bkdtrackedtpi" &&
-      ((!event.m_passes_cuts && event.m_passes_trackless_cuts) ||
-       (event.m_passes_cuts && event.m_passes_trackless_cuts)))
-    return;
-
-  if (name == "bkdtracklesstpi" &&
-      ((event.m_passes_cuts && !event.m_passes_trackless_cuts) ||
-       (event.m_passes_cuts && event.m_passes_trackless_cuts)))
-    return;
+// Whether the migration of reco_var gets filled for this event, and with
+// what reco and true values. Shared by FillMigration and
+// FillMigrationVertical.
+bool ccpi_event::GetMigrationFillValues(const CCPiEvent& event,
+                                        const VariableFillInfo& reco_info,
+                                        const Variable* true_var,
+                                        double& reco_fill_val,
+                                        double& true_fill_val) {
+  // mtpi and mthetapi_deg migrations are filled for tracked events too
+  if (reco_info.pion_role != kUntrackedPion &&
+      !PassesPionRole(reco_info.pion_role, event.m_passes_cuts,
+                      event.m_passes_trackless_cuts))
+    return false;
 
-  if (name == "bkdmixtpi" &&
-      ((!event.m_passes_cuts && event.m_passes_trackless_cuts) ||
-       (event.m_passes_cuts && !event.m_passes_trackless_cuts)))
-    return;
-
-  if (name == "tpi" && !event.m_passes_cuts) return;
-
-  if (name == "thetapi_deg" && !event.m_passes_cuts) return;
-  /*
-    if (name == "mtpi" && !event.m_passes_trackless_cuts)
-          return;
-
-    if (name == "mthetapi_deg" && !event.m_passes_trackless_cuts)
-          return;
-  */
   RecoPionIdx reco_idx = event.m_highest_energy_pion_idx;
   TruePionIdx true_idx = GetHighestEnergyTruePionIndex(event);
 
-  if (event.m_universe->GetThetamuTrue() < 0.226892803 &&
-      event.m_universe->GetMixedTpiTrue(true_idx) > 35.) {
-    if (reco_var->Name() == "mixtpi_NoAaron" ||
-        reco_var->Name() == "q2_NoAaron")
-      return;
-  } else {
-    if (reco_var->Name() == "mixtpi_Aaron" || reco_var->Name() == "q2_Aaron")
-      return;
-  }
+  if (reco_info.aaron_role != kNoAaronSplit &&
+      !PassesAaronRole(reco_info.aaron_role,
+                       IsInAaronPhaseSpaceTrue(*event.m_universe, true_idx)))
+    return false;
 
-  double reco_fill_val = reco_var->GetValue(*event.m_universe, reco_idx);
-  double true_fill_val = true_var->GetValue(*event.m_universe, true_idx);
-  reco_var->m_hists.m_migration.FillUniverse(*event.m_universe, reco_fill_val,
-                                             true_fill_val, event.m_weight);
+  reco_fill_val = reco_info.var->GetValue(*event.m_universe, reco_idx);
+  true_fill_val = true_var->GetValue(*event.m_universe, true_idx);
+  return true;
 }
 
-// Only for true variables
-void ccpi_event::FillEfficiencyDenominator(
-    const CCPiEvent& event, const std::vector<Variable*>& variables) {
-  for (auto var : variables) {
-    if (!var->m_is_true) continue;
-    TruePionIdx idx = GetHighestEnergyTruePionIndex(event);
+void ccpi_event::FillMigration(const CCPiEvent& event,
+                               const VariableFillInfo& reco_info,
+                               const Variable* true_var) {
+  double reco_fill_val = -999., true_fill_val = -999.;
+  if (!GetMigrationFillValues(event, reco_info, true_var, reco_fill_val,
+                              true_fill_val))
+    return;
+  reco_info.var->m_hists.m_migration.FillUniverse(
+      *event.m_universe, reco_fill_val, true_fill_val, event.m_weight);
+}
 
-    if (event.m_universe->GetThetamuTrue() < 0.226892803 &&
-        event.m_universe->GetMixedTpiTrue(idx) > 35.) {
-      if (var->Name() == "mixtpi_NoAaron_true" ||
-          var->Name() == "q2_NoAaron_true")
-        continue;
-    } else {
-      if (var->Name() == "mixtpi_Aaron_true" || var->Name() == "q2_Aaron_true")
-        continue;
-    }
+// Whether var gets filled in the efficiency denominator, and with what value.
+// Shared by FillEfficiencyDenominator and FillTruthEventVertical.
+bool ccpi_event::GetEffDenFillValue(const CCPiEvent& event,
+                                    const VariableFillInfo& info,
+                                    double& fill_val) {
+  const Variable* var = info.var;
+  if (!var->m_is_true) return false;
+  TruePionIdx idx = GetHighestEnergyTruePionIndex(event);
+
+  if (info.aaron_role != kNoAaronSplit &&
+      !PassesAaronRole(info.aaron_role,
+                       IsInAaronPhaseSpaceTrue(*event.m_universe, idx)))
+    return false;
+
+  fill_val = var->GetValue(*event.m_universe, idx);
+  return true;
+}
 
-    double fill_val = var->GetValue(*event.m_universe, idx);
+// Only for true variables
+void ccpi_event::FillEfficiencyDenominator(const CCPiEvent& event,
+                                           const FillPlan& plan) {
+  for (const auto& info : plan.infos) {
+    Variable* var = info.var;
+    double fill_val = -999.;
+    if (!GetEffDenFillValue(event, info, fill_val)) continue;
     /*if(event.m_universe->ShortName() == "CCPi+ Tune"){
       std::cout << "Weight effden = " <<
               event.m_weight << "\n";
@@ -485,6 +518,177 @@ void ccpi_event::FillEfficiencyDenominator(
   }
 }
 
+//==============================================================================
+// Vertical-only universe fill functions
+//
+// A vertical-only universe has the CV's selection and the CV's fill values;
+// only its weight differs. So for each variable, find the bin once from the CV
+// event, then add each universe's weight to that bin of its hist. Its bins
+// are the same as a fill of the value's; its mean and RMS are its bins' (see
+// FillBinCenter).
+//==============================================================================
+template <typename HW>
+void ccpi_event::FillVerticalUniverses(
+    HW& hw, const int bin, const std::vector<VerticalUniverseWeight>& weights,
+    const bool use_no_tpi_weight) {
+  for (const auto& w : weights)
+    FillBinCenter(hw.univHist(w.universe), bin,
+                  use_no_tpi_weight ? w.no_tpi_weight : w.weight);
+}
+
+// FlatHW fills its own universes, flat or not
+void ccpi_event::FillVerticalUniverses(
+    FlatHW& hw, const int bin,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const bool use_no_tpi_weight) {
+  for (const auto& w : weights)
+    hw.AddToUniverseBin(w.universe, bin,
+                        use_no_tpi_weight ? w.no_tpi_weight : w.weight);
+}
+
+void ccpi_event::FillRecoEventVertical(
+    const CCPiEvent& cv_event,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const FillPlan& plan) {
+  if (weights.empty()) return;
+  assert(cv_event.m_is_mc && !cv_event.m_is_truth);
+
+  const bool passes_any = cv_event.m_passes_cuts ||
+                          cv_event.m_passes_trackless_cuts;
+  if (passes_any) FillSelectedVertical(cv_event, weights, plan);
+
+  if ((cv_event.m_is_w_sideband || cv_event.m_passes_trackless_sideband) &&
+      !passes_any)
+    FillWSidebandVertical(cv_event, weights, plan);
+
+  // FillWSideband_Study is CV-only
+
+  if (cv_event.m_is_signal && passes_any) {
+    for (const auto& pair : plan.migration_pairs)
+      FillMigrationVertical(cv_event, weights, plan.infos[pair.first],
+                            plan.variables[pair.second]);
+  }
+}
+
+void ccpi_event::FillTruthEventVertical(
+    const CCPiEvent& cv_event,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const FillPlan& plan) {
+  if (weights.empty() || !cv_event.m_is_signal) return;
+  for (const auto& info : plan.infos) {
+    double fill_val = -999.;
+    if (!GetEffDenFillValue(cv_event, info, fill_val)) continue;
+    Histograms& h = info.var->m_hists;
+    const int bin = h.m_effden.FindBin(fill_val);
+    FillVerticalUniverses(h.m_effden, bin, weights);
+  }
+}
+
+void ccpi_event::FillSelectedVertical(
+    const CCPiEvent& cv_event,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const FillPlan& plan) {
+  const bool tracked = cv_event.m_passes_cuts;
+  const bool trackless = cv_event.m_passes_trackless_cuts;
+  for (const auto& info : plan.infos) {
+    double fill_val = -999.;
+    if (!GetSelectedFillValue(cv_event, info, fill_val)) continue;
+
+    // All of a variable's hists share its binning
+    Histograms& h = info.var->m_hists;
+    const int bin = h.m_selection_mc.FindBin(fill_val);
+
+    const bool no_tpi = true;
+    FillVerticalUniverses(h.m_selection_mc, bin, weights);
+    FillVerticalUniverses(h.m_selection_mc_no_tpi_weight, bin, weights, no_tpi);
+    if (tracked && !trackless) {
+      FillVerticalUniverses(h.m_selection_mc_tracked, bin, weights);
+      FillVerticalUniverses(h.m_selection_mc_tracked_no_tpi_weight, bin,
+                            weights, no_tpi);
+    }
+    if (!tracked && trackless) {
+      FillVerticalUniverses(h.m_selection_mc_untracked, bin, weights);
+      FillVerticalUniverses(h.m_selection_mc_untracked_no_tpi_weight, bin,
+                            weights, no_tpi);
+    }
+    if (tracked && trackless) {
+      FillVerticalUniverses(h.m_selection_mc_mixed, bin, weights);
+      FillVerticalUniverses(h.m_selection_mc_mixed_no_tpi_weight, bin, weights,
+                            no_tpi);
+    }
+
+    if (cv_event.m_is_signal) {
+      FillVerticalUniverses(h.m_effnum, bin, weights);
+      continue;
+    }
+
+    FillVerticalUniverses(h.m_bg, bin, weights);
+    switch (cv_event.m_w_type) {
+      case kWSideband_Signal:
+        break;
+      case kWSideband_Low:
+        FillVerticalUniverses(h.m_bg_loW, bin, weights);
+        break;
+      case kWSideband_Mid:
+        FillVerticalUniverses(h.m_bg_midW, bin, weights);
+        break;
+      case kWSideband_High:
+        FillVerticalUniverses(h.m_bg_hiW, bin, weights);
+        break;
+      default:
+        std::cerr << "FillSelectedVertical: no such W category\n";
+        std::exit(2);
+    }
+  }
+}
+
+void ccpi_event::FillWSidebandVertical(
+    const CCPiEvent& cv_event,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const FillPlan& plan) {
+  if (plan.sideband_fit_var < 0) {
+    std::cerr << "FillWSidebandVertical: variables container is missing fit "
+                 "var\n";
+    std::exit(1);
+  }
+  for (const auto& info : plan.infos) {
+    double fill_val = -999.;
+    if (!GetWSidebandFillValue(cv_event, info, fill_val)) continue;
+    Histograms& h = info.var->m_hists;
+    const int bin = h.m_wsidebandfit_sig.FindBin(fill_val);
+    switch (cv_event.m_w_type) {
+      case kWSideband_Signal:
+        FillVerticalUniverses(h.m_wsidebandfit_sig, bin, weights);
+        break;
+      case kWSideband_Low:
+        FillVerticalUniverses(h.m_wsidebandfit_loW, bin, weights);
+        break;
+      case kWSideband_Mid:
+        FillVerticalUniverses(h.m_wsidebandfit_midW, bin, weights);
+        break;
+      case kWSideband_High:
+        FillVerticalUniverses(h.m_wsidebandfit_hiW, bin, weights);
+        break;
+      default:
+        std::cerr << "FillWSidebandVertical: invalid W category\n";
+        std::exit(2);
+    }
+  }
+}
+
+void ccpi_event::FillMigrationVertical(
+    const CCPiEvent& cv_event,
+    const std::vector<VerticalUniverseWeight>& weights,
+    const VariableFillInfo& reco_info, const Variable* true_var) {
+  double reco_fill_val = -999., true_fill_val = -999.;
+  if (!GetMigrationFillValues(cv_event, reco_info, true_var, reco_fill_val,
+                              true_fill_val))
+    return;
+  Histograms& h = reco_info.var->m_hists;
+  const int bin = h.m_migration.hist->FindBin(reco_fill_val, true_fill_val);
+  FillVerticalUniverses(h.m_migration, bin, weights);
+}
+
 //==============================================================================
 // Specialized fill functions -- for studies
 //==============================================================================
@@ -492,8 +696,8 @@ void ccpi_event::FillEfficiencyDenominator(
 // visualizing the sideband sample. These hists are filled for study purposes
 // only. Other hists owned by this variable are used to perform the fit (those
 // are filled in FillWSideband.)
-void ccpi_event::FillWSideband_Study(const CCPiEvent& event,
-                                     std::vector<Variable*> variables) {
+void ccpi_event::FillWSideband_Study(
+    const CCPiEvent& event, const std::vector<Variable*>& variables) {
   if (event.m_universe->ShortName() != "cv") {
     std::cerr << "FillWSideband_Study Warning: you're filling the wexp_fit "
                  "variable w/o the W-cut for a universe other than the CV\n";
@@ -625,13 +829,14 @@ std::pair<EventCount, EventCount> ccpi_event::FillCounters(
   bool pass_Mpi_cut = true;
 
   if (!event.m_is_truth) {
+    timing::ScopedTimer cuts_timer(timing::kCuts);
     vtx_michels = event.m_universe->GetVtxMichels();
     endpoint_michels_multpiCut = GetTrackedPionCandidates(event);
     if (vtx_michels.m_idx != -1) {
       unique_michel_idx_untracked =
           vtx_michels.m_nmichels[vtx_michels.m_idx].tuple_idx;
     }
-    for (auto candidate : endpoint_michels_multpiCut) {
+    for (const auto& candidate : endpoint_michels_multpiCut) {
       unique_michel_idx_tracked.push_back(candidate.first);
     }
 
@@ -651,9 +856,12 @@ std::pair<EventCount, EventCount> ccpi_event::FillCounters(
   for (auto i_cut : kDefCutsVector) {
     if (event.m_is_truth != IsPrecut(i_cut)) continue;
     bool passes_this_cut = true;
-    std::tie(passes_this_cut, endpoint_michels, vtx_michels) =
-        PassesCut(*event.m_universe, i_cut, event.m_is_mc,
-                  event.m_signal_definition, endpoint_michels, vtx_michels);
+    {
+      timing::ScopedTimer cuts_timer(timing::kCuts);
+      std::tie(passes_this_cut, endpoint_michels, vtx_michels) =
+          PassesCut(*event.m_universe, i_cut, event.m_is_mc,
+                    event.m_signal_definition, endpoint_michels, vtx_michels);
+    }
 
     event.m_universe->SetPionCandidates(
         GetHadIdxsFromMichels(endpoint_michels, vtx_michels));
@@ -682,6 +890,7 @@ std::pair<EventCount, EventCount> ccpi_event::FillCounters(
       if (i_cut == kTrackedMpi) {
         passes_this_cut = passes_this_cut && pass_Mpi_cut;
       } else {
+        timing::ScopedTimer cuts_timer(timing::kCuts);
         std::tie(passes_this_cut, endpoint_michels, vtx_michels) =
             PassesCut(*event.m_universe, i_cut, event.m_is_mc,
                       event.m_signal_definition, endpoint_michels, vtx_michels);
@@ -787,7 +996,7 @@ void ccpi_event::FillCutVars(CCPiEvent& event,
     if (!pass) continue;
 
     // fill container of pion candidate idxs
-    for (auto m : endpoint_michels)
+    for (const auto& m : endpoint_michels)
       event.m_reco_pion_candidate_idxs.push_back(m.second.had_idx);
 
     // Get the highest energy pion candidate
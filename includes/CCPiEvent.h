@@ -7,6 +7,7 @@
 #include "SignalDefinition.h"
 #include "TruthCategories/Sidebands.h"         // WSidebandType
 #include "TruthCategories/SignalBackground.h"  // SignalBackgroundType
+#include "TH1.h"
 #include "Variable.h"
 class Variable;
 
@@ -32,6 +33,14 @@ struct CCPiEvent {
   CCPiEvent(const bool is_mc, const bool is_truth,
             const SignalDefinition signal_definition, CVUniverse* universe);
 
+  // Events whose signal status and W type the caller already has: truth
+  // events, for which they're the same in every universe and so are computed
+  // once per entry, and selections read from a selection cache. m_weight is
+  // left for the caller, too.
+  CCPiEvent(const bool is_mc, const bool is_truth,
+            const SignalDefinition signal_definition, CVUniverse* universe,
+            const bool is_signal, const WSidebandType w_type);
+
   // Fixed by the constructor
   const bool m_is_mc;
   const bool m_is_truth;
@@ -55,26 +64,124 @@ struct CCPiEvent {
   std::vector<int> m_unique_michel_idx_tracked;
 };
 
+// Weight of one vertical-only universe for an event. These universes share the
+// CV's selection and fill values, so they're filled together from the CV's
+// CCPiEvent (see ccpi_event::FillRecoEventVertical).
+struct VerticalUniverseWeight {
+  CVUniverse* universe;
+  double weight;
+  double no_tpi_weight;  // weight / GetUntrackedPionWeight()
+};
+
 // Helper Functions
 // bool IsWSideband(CCPiEvent&);
-PassesCutsInfo PassesCuts(const CCPiEvent&);
+PassesCutsInfo PassesCuts(const CCPiEvent&,
+                          const bool need_pion_candidates = true);
 RecoPionIdx GetHighestEnergyPionCandidateIndex(const CCPiEvent&);
 SignalBackgroundType GetSignalBackgroundType(const CCPiEvent&);
 endpoint::MichelMap GetTrackedPionCandidates(const CCPiEvent&);
 
 // Helper Fill Histo Functions
 namespace ccpi_event {
+// Reco variables that have a migration matrix (if their _true partner exists)
+const std::vector<std::string> kMigrationVars = {
+    "tpi",           "thetapi_deg",     "pmu",          "pzmu",
+    "ptmu",          "thetamu_deg",     "q2",           "q2_Aaron",
+    "q2_NoAaron",    "enu",             "wexp",         "ehad",
+    "cosadtheta",    "adphi",           "pimuAngle",    "PT",
+    "mtpi",          "mixtpi",          "mixtpi_Aaron", "mixtpi_NoAaron",
+    "bkdtrackedtpi", "bkdtracklesstpi", "bkdmixtpi",    "mthetapi_deg",
+    "mixthetapi_deg"};
+
+//==============================================================================
+// Fill plan
+//
+// Which events each variable is filled for depends only on its name. Work
+// that out once, before the event loop, so the fill functions below never
+// compare strings.
+//==============================================================================
+// Which of the tracked/trackless selections a variable is filled for
+enum EPionRole {
+  kAnyPion,        // any selected event
+  kTrackedPion,    // tpi, thetapi_deg
+  kUntrackedPion,  // mtpi, mthetapi_deg
+  kBkdTracked,     // bkdtrackedtpi -- not passing the trackless cuts
+  kBkdTrackless,   // bkdtracklesstpi -- not passing the tracked cuts
+  kBkdMixed        // bkdmixtpi -- passing both or neither
+};
+
+// Aaron's phase space: thetamu < 13 deg and mixed tpi > 35 MeV
+enum EAaronRole {
+  kNoAaronSplit,
+  kAaronOnly,   // mixtpi_Aaron, q2_Aaron (and _true)
+  kNoAaronOnly  // mixtpi_NoAaron, q2_NoAaron (and _true)
+};
+
+struct VariableFillInfo {
+  Variable* var;
+  EPionRole pion_role;
+  EAaronRole aaron_role;
+};
+
+struct FillPlan {
+  std::vector<Variable*> variables;
+  std::vector<VariableFillInfo> infos;  // same order as variables
+  // Indices into variables of {reco, true} variables with a migration matrix
+  std::vector<std::pair<int, int>> migration_pairs;
+  int sideband_fit_var;  // index of sidebands::kFitVarString, -1 if missing
+};
+
+FillPlan MakeFillPlan(const std::vector<Variable*>&);
+
 // Xsec analysis fill functions
-void FillSelected(const CCPiEvent&, const std::vector<Variable*>&);
-void FillRecoEvent(const CCPiEvent&, const std::vector<Variable*>&);
-void FillWSideband(const CCPiEvent&, const std::vector<Variable*>&);
-void FillTruthEvent(const CCPiEvent&, const std::vector<Variable*>&);
-void FillEfficiencyDenominator(const CCPiEvent&, const std::vector<Variable*>&);
-void FillMigration(const CCPiEvent&, const std::vector<Variable*>&,
-                   std::string name);
+void FillSelected(const CCPiEvent&, const FillPlan&);
+void FillRecoEvent(const CCPiEvent&, const FillPlan&);
+void FillWSideband(const CCPiEvent&, const FillPlan&);
+void FillTruthEvent(const CCPiEvent&, const FillPlan&);
+void FillEfficiencyDenominator(const CCPiEvent&, const FillPlan&);
+void FillMigration(const CCPiEvent&, const VariableFillInfo& reco_info,
+                   const Variable* true_var);
+
+// Which variables get filled, and with what value -- shared by the
+// per-universe and vertical-only fill functions
+bool GetSelectedFillValue(const CCPiEvent&, const VariableFillInfo&,
+                          double& fill_val);
+bool GetWSidebandFillValue(const CCPiEvent&, const VariableFillInfo&,
+                           double& fill_val);
+bool GetEffDenFillValue(const CCPiEvent&, const VariableFillInfo&,
+                        double& fill_val);
+bool GetMigrationFillValues(const CCPiEvent&,
+                            const VariableFillInfo& reco_info,
+                            const Variable* true_var, double& reco_fill_val,
+                            double& true_fill_val);
+
+// Vertical-only universe fill functions -- take the CV event
+template <typename HW>
+void FillVerticalUniverses(HW&, const int bin,
+                           const std::vector<VerticalUniverseWeight>&,
+                           const bool use_no_tpi_weight = false);
+void FillVerticalUniverses(FlatHW&, const int bin,
+                           const std::vector<VerticalUniverseWeight>&,
+                           const bool use_no_tpi_weight = false);
+void FillRecoEventVertical(const CCPiEvent&,
+                           const std::vector<VerticalUniverseWeight>&,
+                           const FillPlan&);
+void FillTruthEventVertical(const CCPiEvent&,
+                            const std::vector<VerticalUniverseWeight>&,
+                            const FillPlan&);
+void FillSelectedVertical(const CCPiEvent&,
+                          const std::vector<VerticalUniverseWeight>&,
+                          const FillPlan&);
+void FillWSidebandVertical(const CCPiEvent&,
+                           const std::vector<VerticalUniverseWeight>&,
+                           const FillPlan&);
+void FillMigrationVertical(const CCPiEvent&,
+                           const std::vector<VerticalUniverseWeight>&,
+                           const VariableFillInfo& reco_info,
+                           const Variable* true_var);
 
 // Study functions
-void FillWSideband_Study(const CCPiEvent&, std::vector<Variable*>);
+void FillWSideband_Study(const CCPiEvent&, const std::vector<Variable*>&);
 void FillCounters(const CCPiEvent&,
                   const std::pair<EventCount*, EventCount*>& counters);
 std::pair<EventCount, EventCount> FillCounters(const CCPiEvent&,
@@ -11,11 +11,87 @@
 #include "PlotUtils/MnvTuneSystematics.h"
 #include "utilities.h"  // FixAngle
 
+//==============================================================================
+// Tuple branches read by the getters below
+//==============================================================================
+namespace branches {
+const BranchHandle kBlobRecoilEEcal("blob_recoil_E_ecal");
+const BranchHandle kBlobRecoilETracker("blob_recoil_E_tracker");
+const BranchHandle kHadronTrackLengthArea("hadron_track_length_area");
+const BranchHandle kHasMichelCalEnergy("has_michel_cal_energy");
+const BranchHandle kIsMinosMatchTrack("isMinosMatchTrack");
+const BranchHandle kMasterAnaDevHadron1stTrackPatRec(
+    "MasterAnaDev_hadron_1stTrackPatRec");
+const BranchHandle kMasterAnaDevHadronNumber("MasterAnaDev_hadron_number");
+const BranchHandle kMasterAnaDevHadronPiFitScore1(
+    "MasterAnaDev_hadron_piFit_score1");
+const BranchHandle kMasterAnaDevHadronPiFitScoreLLR(
+    "MasterAnaDev_hadron_piFit_scoreLLR");
+const BranchHandle kMasterAnaDevHadronPionERecoilCorr(
+    "MasterAnaDev_hadron_pion_E_recoil_corr");
+const BranchHandle kMasterAnaDevHadronPionPCorr(
+    "MasterAnaDev_hadron_pion_p_corr");
+const BranchHandle kMasterAnaDevHadronRecoilCCInc(
+    "MasterAnaDev_hadron_recoil_CCInc");
+const BranchHandle kMasterAnaDevHadronRecoilDefault(
+    "MasterAnaDev_hadron_recoil_default");
+const BranchHandle kMasterAnaDevHadronRecoilTwoTrack(
+    "MasterAnaDev_hadron_recoil_two_track");
+const BranchHandle kMasterAnaDevHadronTmBeginKE(
+    "MasterAnaDev_hadron_tm_beginKE");
+const BranchHandle kMasterAnaDevHadronTmPDGCode(
+    "MasterAnaDev_hadron_tm_PDGCode");
+const BranchHandle kMasterAnaDevHadronTmTrackID(
+    "MasterAnaDev_hadron_tm_trackID");
+const BranchHandle kMasterAnaDevNuHelicity("MasterAnaDev_nuHelicity");
+const BranchHandle kMasterAnaDevPionE("MasterAnaDev_pion_E");
+const BranchHandle kMasterAnaDevPionLastnodeQ0("MasterAnaDev_pion_lastnode_Q0");
+const BranchHandle kMasterAnaDevPionLastnodeQ1("MasterAnaDev_pion_lastnode_Q1");
+const BranchHandle kMasterAnaDevPionLastnodeQ2("MasterAnaDev_pion_lastnode_Q2");
+const BranchHandle kMasterAnaDevPionLastnodeQ3("MasterAnaDev_pion_lastnode_Q3");
+const BranchHandle kMasterAnaDevPionLastnodeQ4("MasterAnaDev_pion_lastnode_Q4");
+const BranchHandle kMasterAnaDevPionLastnodeQ5("MasterAnaDev_pion_lastnode_Q5");
+const BranchHandle kMasterAnaDevPionNNodes("MasterAnaDev_pion_nNodes");
+const BranchHandle kMasterAnaDevPionP("MasterAnaDev_pion_P");
+const BranchHandle kMasterAnaDevPionPx("MasterAnaDev_pion_Px");
+const BranchHandle kMasterAnaDevPionPy("MasterAnaDev_pion_Py");
+const BranchHandle kMasterAnaDevPionPz("MasterAnaDev_pion_Pz");
+const BranchHandle kMasterAnaDevPionTheta("MasterAnaDev_pion_theta");
+const BranchHandle kMasterAnaDevVtx("MasterAnaDev_vtx");
+const BranchHandle kMcIncomingPartVec("mc_incomingPartVec");
+const BranchHandle kMcIntType("mc_intType");
+const BranchHandle kMcNthEvtInFile("mc_nthEvtInFile");
+const BranchHandle kMcPrimFSLepton("mc_primFSLepton");
+const BranchHandle kMcRun("mc_run");
+const BranchHandle kMcSubrun("mc_subrun");
+const BranchHandle kMcTargetZ("mc_targetZ");
+const BranchHandle kMcVtx("mc_vtx");
+const BranchHandle kMcW("mc_w");
+const BranchHandle kNAnchoredLongTrkProngs("n_anchored_long_trk_prongs");
+const BranchHandle kNAnchoredShortTrkProngs("n_anchored_short_trk_prongs");
+const BranchHandle kNNonvtxIsoBlobsAll("n_nonvtx_iso_blobs_all");
+const BranchHandle kSliceNumbers("slice_numbers");
+const BranchHandle kTruthGenieWgtMaRES("truth_genie_wgt_MaRES");
+const BranchHandle kTruthGenieWgtThetaDelta2Npi(
+    "truth_genie_wgt_Theta_Delta2Npi");
+const BranchHandle kTruthNPim("truth_N_pim");
+const BranchHandle kTruthNPip("truth_N_pip");
+const BranchHandle kTruthPiCharge("truth_pi_charge");
+const BranchHandle kTruthPiE("truth_pi_E");
+const BranchHandle kTruthPiPx("truth_pi_px");
+const BranchHandle kTruthPiPy("truth_pi_py");
+const BranchHandle kTruthPiPz("truth_pi_pz");
+const BranchHandle kTruthPiThetaWrtbeam("truth_pi_theta_wrtbeam");
+}  // namespace branches
+
 //==============================================================================
 // Constructor
 //==============================================================================
 CVUniverse::CVUniverse(PlotUtils::ChainWrapper* chw, double nsigma)
-    : PlotUtils::MinervaUniverse(chw, nsigma) {}
+    : PlotUtils::MinervaUniverse(chw, nsigma),
+      m_branches(GetBranchRegistry(chw)),
+      m_shifted_weight_factor(-1),
+      m_hadron_quality(nullptr) {}
 
 //==============================================================================
 // Print arachne link
@@ -23,10 +99,10 @@ CVUniverse::CVUniverse(PlotUtils::ChainWrapper* chw, double nsigma)
 void CVUniverse::PrintArachneLink() const {
   int link_size = 200;
   char link[link_size];
-  int run = GetInt("mc_run");
-  int subrun = GetInt("mc_subrun");
-  int gate = GetInt("mc_nthEvtInFile") + 1;
-  int slice = GetVecElem("slice_numbers", 0);
+  int run = GetMCRun();
+  int subrun = GetMCSubrun();
+  int gate = GetMCGate();
+  int slice = Read(branches::kSliceNumbers, 0);
   sprintf(link,
           "http://minerva05.fnal.gov/Arachne/"
           "arachne.html\?det=SIM_minerva&recoVer=v21r1p1&run=%d&subrun=%d&gate="
@@ -37,6 +113,14 @@ void CVUniverse::PrintArachneLink() const {
   std::cout << link << std::endl;
 }
 
+int CVUniverse::GetMCRun() const { return ReadInt(branches::kMcRun); }
+
+int CVUniverse::GetMCSubrun() const { return ReadInt(branches::kMcSubrun); }
+
+int CVUniverse::GetMCGate() const {
+  return ReadInt(branches::kMcNthEvtInFile) + 1;
+}
+
 //==============================================================================
 // Dummy access for variable constructors
 //==============================================================================
@@ -120,6 +204,7 @@ void CVUniverse::SetPionCandidates(std::vector<RecoPionIdx> c) {
   m_pion_candidates = c;
   SetNonCalIndices(c);  // for part response syst -- particle(s) that we've
                         // reco-ed by tracking and not by calorimetry
+  ClearKinematicsCache();
 }
 
 void CVUniverse::SetPassesTrakedTracklessCuts(
@@ -131,6 +216,7 @@ void CVUniverse::SetPassesTrakedTracklessCuts(
   m_passesTracklessSideband = trackless_sideband;
   m_passesTrackedExceptW = tracked_all_ex_w;
   m_passesTracklessExceptW = trackless_all_ex_w;
+  ClearKinematicsCache();
 }
 
 //==============================================================================
@@ -152,36 +238,77 @@ double CVUniverse::GetThetamuDeg() const {
 }
 
 // event-wide
+double CVUniverse::GetTrackedEhad() const {
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_tracked_ehad) {
+    c.tracked_ehad = GetCalRecoilEnergy() + GetTrackRecoilEnergy();
+    c.has_tracked_ehad = true;
+  }
+  return c.tracked_ehad;
+}
+
+double CVUniverse::GetTracklessEhad() const {
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_trackless_ehad) {
+    c.trackless_ehad = GetEavail() + GetNMichels() * MinervaUnits::M_pion;
+    c.has_trackless_ehad = true;
+  }
+  return c.trackless_ehad;
+}
+
 double CVUniverse::GetEhad() const {
+  KinematicsCache& c = m_kinematics_cache;
+  if (c.has_ehad) return c.ehad;
+
   if (m_passesTrackedCuts) {
-    return GetCalRecoilEnergy() + GetTrackRecoilEnergy();
+    c.ehad = GetTrackedEhad();
   } else if (m_passesTracklessCuts)
-    return GetEavail() + GetNMichels() * MinervaUnits::M_pion;
+    c.ehad = GetTracklessEhad();
   else if (m_passesTrackedSideband)
-    return GetCalRecoilEnergy() + GetTrackRecoilEnergy();
+    c.ehad = GetTrackedEhad();
   else if (m_passesTracklessSideband)
-    return GetEavail() + GetNMichels() * MinervaUnits::M_pion;
+    c.ehad = GetTracklessEhad();
   else if (m_passesTrackedExceptW)
-    return GetCalRecoilEnergy() + GetTrackRecoilEnergy();
+    c.ehad = GetTrackedEhad();
   else if (m_passesTracklessExceptW)
-    return GetEavail() + GetNMichels() * MinervaUnits::M_pion;
+    c.ehad = GetTracklessEhad();
   else {
     std::cout << "CVUniverse::GetEhad It is not passing the correct there "
                  "something wrong with the cuts True\n";
     std::exit(1);
   }
+  c.has_ehad = true;
+  return c.ehad;
 
   //  return GetEavail() + GetNMichels() * MinervaUnits::M_pion;
   //  return GetCalRecoilEnergy() + GetTrackRecoilEnergy();
 }
-double CVUniverse::GetEnu() const { return GetEmu() + GetEhad(); }
+
+double CVUniverse::GetEnu() const {
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_enu) {
+    c.enu = GetEmu() + GetEhad();
+    c.has_enu = true;
+  }
+  return c.enu;
+}
 
 double CVUniverse::GetQ2() const {
-  return CalcQ2(GetEnu(), GetEmu(), GetThetamu());
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_q2) {
+    c.q2 = CalcQ2(GetEnu(), GetEmu(), GetThetamu());
+    c.has_q2 = true;
+  }
+  return c.q2;
 }
 
 double CVUniverse::GetWexp() const {
-  return CalcWexp(GetQ2(), GetEhad());
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_wexp) {
+    c.wexp = CalcWexp(GetQ2(), GetEhad());
+    c.has_wexp = true;
+  }
+  return c.wexp;
   /*  if (m_passesTrackedCuts){
       return GetTrackedWexp();
     }
@@ -198,17 +325,27 @@ double CVUniverse::GetWexp() const {
 }
 
 double CVUniverse::GetTracklessWexp() const {
-  return CalcWexp(
-      CalcQ2(GetEmu() + GetEavail() + GetNMichels() * MinervaUnits::M_pion,
-             GetEmu(), GetThetamu()),
-      GetEavail() + GetNMichels() * MinervaUnits::M_pion);
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_trackless_wexp) {
+    c.trackless_wexp = CalcWexp(
+        CalcQ2(GetEmu() + GetEavail() + GetNMichels() * MinervaUnits::M_pion,
+               GetEmu(), GetThetamu()),
+        GetTracklessEhad());
+    c.has_trackless_wexp = true;
+  }
+  return c.trackless_wexp;
 }
 
 double CVUniverse::GetTrackedWexp() const {
-  return CalcWexp(
-      CalcQ2(GetEmu() + GetCalRecoilEnergy() + GetTrackRecoilEnergy(), GetEmu(),
-             GetThetamu()),
-      GetCalRecoilEnergy() + GetTrackRecoilEnergy());
+  KinematicsCache& c = m_kinematics_cache;
+  if (!c.has_tracked_wexp) {
+    c.tracked_wexp = CalcWexp(
+        CalcQ2(GetEmu() + GetCalRecoilEnergy() + GetTrackRecoilEnergy(),
+               GetEmu(), GetThetamu()),
+        GetTrackedEhad());
+    c.has_tracked_wexp = true;
+  }
+  return c.tracked_wexp;
 }
 
 double CVUniverse::Getq0() const { return Calcq0(GetEnu(), GetEmu()); }
@@ -228,9 +365,9 @@ double CVUniverse::GetTracklessq3() const {
 double CVUniverse::GetALR(RecoPionIdx hadron) const {
   TVector3 NeuDir(0., 0., 1.);
   TVector3 MuDir(GetPXmu(), GetPYmu(), GetPZmu());
-  TVector3 PiDir(GetVecElem("MasterAnaDev_pion_Px", hadron),
-                 GetVecElem("MasterAnaDev_pion_Py", hadron),
-                 GetVecElem("MasterAnaDev_pion_Pz", hadron));
+  TVector3 PiDir(Read(branches::kMasterAnaDevPionPx, hadron),
+                 Read(branches::kMasterAnaDevPionPy, hadron),
+                 Read(branches::kMasterAnaDevPionPz, hadron));
   TVector3 PlaneDir = NeuDir.Cross(MuDir);
   double proy = PlaneDir.Dot(PiDir);
   if (proy == 0) return 0.1;
@@ -242,14 +379,14 @@ double CVUniverse::GetALR(RecoPionIdx hadron) const {
 
 double CVUniverse::GetAdlerCosTheta(RecoPionIdx hadron) const {
   double mumom = GetPmu();
-  double pimom = GetVecElem("MasterAnaDev_pion_P", hadron);
+  double pimom = Read(branches::kMasterAnaDevPionP, hadron);
   double Enu = GetEnu();
   TVector3 NeuDir(0., 0.057564027, 0.998341817);
   TVector3 MuDir(GetPXmu(), GetPYmu(), GetPZmu());
   MuDir = MuDir.Unit();
-  TVector3 PiDir(GetVecElem("MasterAnaDev_pion_Px", hadron),
-                 GetVecElem("MasterAnaDev_pion_Py", hadron),
-                 GetVecElem("MasterAnaDev_pion_Pz", hadron));
+  TVector3 PiDir(Read(branches::kMasterAnaDevPionPx, hadron),
+                 Read(branches::kMasterAnaDevPionPy, hadron),
+                 Read(branches::kMasterAnaDevPionPz, hadron));
   PiDir = PiDir.Unit();
   TVector3 AdAngle = AdlerAngle(2, mumom /*GeV*/, pimom /*GeV*/, NeuDir, MuDir,
                                 PiDir, Enu /*GeV*/);
@@ -258,14 +395,14 @@ double CVUniverse::GetAdlerCosTheta(RecoPionIdx hadron) const {
 
 double CVUniverse::GetAdlerPhi(RecoPionIdx hadron) const {
   double mumom = GetPmu();
-  double pimom = GetVecElem("MasterAnaDev_pion_P", hadron);
+  double pimom = Read(branches::kMasterAnaDevPionP, hadron);
   double Enu = GetEnu();
   TVector3 NeuDir(0., 0.057564027, 0.998341817);
   TVector3 MuDir(GetPXmu(), GetPYmu(), GetPZmu());
   MuDir = MuDir.Unit();
-  TVector3 PiDir(GetVecElem("MasterAnaDev_pion_Px", hadron),
-                 GetVecElem("MasterAnaDev_pion_Py", hadron),
-                 GetVecElem("MasterAnaDev_pion_Pz", hadron));
+  TVector3 PiDir(Read(branches::kMasterAnaDevPionPx, hadron),
+                 Read(branches::kMasterAnaDevPionPy, hadron),
+                 Read(branches::kMasterAnaDevPionPz, hadron));
   PiDir = PiDir.Unit();
   TVector3 AdAngle = AdlerAngle(2, mumom /*GeV*/, pimom /*GeV*/, NeuDir, MuDir,
                                 PiDir, Enu /*GeV*/);
@@ -274,31 +411,31 @@ double CVUniverse::GetAdlerPhi(RecoPionIdx hadron) const {
 
 // dEdx tool w assumption that track is pion
 double CVUniverse::GetEpi(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_E", hadron);
+  return Read(branches::kMasterAnaDevPionE, hadron);
 }
 
 double CVUniverse::GetPT(RecoPionIdx hadron) const {
   TVector3 pT_mu(GetPXmu(), GetPYmu(), 0);
-  TVector3 pT_pi(GetVecElem("MasterAnaDev_pion_Px", hadron),
-                 GetVecElem("MasterAnaDev_pion_Py", hadron), 0);
+  TVector3 pT_pi(Read(branches::kMasterAnaDevPionPx, hadron),
+                 Read(branches::kMasterAnaDevPionPy, hadron), 0);
   TVector3 pT = pT_mu + pT_pi;
   return pT.Mag();
 }
 
 double CVUniverse::GetPXpi(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_Px", hadron);
+  return Read(branches::kMasterAnaDevPionPx, hadron);
 }
 
 double CVUniverse::GetPYpi(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_Py", hadron);
+  return Read(branches::kMasterAnaDevPionPy, hadron);
 }
 
 double CVUniverse::GetPZpi(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_Pz", hadron);
+  return Read(branches::kMasterAnaDevPionPz, hadron);
 }
 
 double CVUniverse::GetPpi(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_P", hadron);
+  return Read(branches::kMasterAnaDevPionP, hadron);
 }
 
 double CVUniverse::GetThetapi(RecoPionIdx hadron) const {
@@ -308,7 +445,7 @@ double CVUniverse::GetThetapi(RecoPionIdx hadron) const {
                  "In that case, this function won't make sense.\n";
     throw hadron;
   }
-  return FixAngle(GetVecElem("MasterAnaDev_pion_theta", hadron));
+  return FixAngle(Read(branches::kMasterAnaDevPionTheta, hadron));
 }
 
 double CVUniverse::GetThetapiDeg(RecoPionIdx hadron) const {
@@ -323,7 +460,7 @@ double CVUniverse::GetTpi(RecoPionIdx hadron) const {
   }
   // return (GetVecElem("MasterAnaDev_hadron_pion_E", hadron)
   //          - CCNuPionIncConsts::CHARGED_PION_MASS)/0.96;
-  double Epi = GetVecElem("MasterAnaDev_pion_E", hadron);
+  double Epi = Read(branches::kMasterAnaDevPionE, hadron);
   if (Epi == 0) {
     return GetTpiMBR(hadron);  // TODO maybe do from momentum instead
                                // Not sure what this fail mode means.
@@ -340,16 +477,16 @@ double CVUniverse::GetTpiMBR(RecoPionIdx hadron) const {
                  "In that case, this function won't make sense.\n";
     throw hadron;
   }
-  double TLA = GetVecElem("hadron_track_length_area", hadron);
+  double TLA = Read(branches::kHadronTrackLengthArea, hadron);
   return 2.3112 * TLA + 37.03;
 }
 
 double CVUniverse::GetpimuAngle(
     RecoPionIdx hadron) const {  // Angle beetwen P_pi and P_mu (degrees)
   TVector3 p_mu(GetPXmu(), GetPYmu(), GetPZmu());
-  TVector3 p_pi(GetVecElem("MasterAnaDev_pion_Px", hadron),
-                GetVecElem("MasterAnaDev_pion_Py", hadron),
-                GetVecElem("MasterAnaDev_pion_Pz", hadron));
+  TVector3 p_pi(Read(branches::kMasterAnaDevPionPx, hadron),
+                Read(branches::kMasterAnaDevPionPy, hadron),
+                Read(branches::kMasterAnaDevPionPz, hadron));
   double PidotMu = p_pi.Dot(p_mu);
   double Pmu = p_mu.Mag(), Ppi = p_pi.Mag();
   return ConvertRadToDeg(acos((PidotMu) / (Pmu * Ppi)));
@@ -422,9 +559,9 @@ double CVUniverse::GetMixedThetapiDeg(RecoPionIdx Idx) const {
 }
 
 double CVUniverse::GetEavail() const {
-  double recoiltracker = GetDouble("blob_recoil_E_tracker") -
+  double recoiltracker = Read(branches::kBlobRecoilETracker) -
                          GetTrackerECALMuFuzz()[0];  // GetTrackerMuFuzz();
-  double recoilEcal = GetDouble("blob_recoil_E_ecal") -
+  double recoilEcal = Read(branches::kBlobRecoilEEcal) -
                       GetTrackerECALMuFuzz()[1];  // GetECALMuFuzz();
   const double Eavailable_scale = 1.17;
   double eavail = recoiltracker + recoilEcal;
@@ -437,12 +574,13 @@ double CVUniverse::GetEavail() const {
 // The output 1 means L, the ouput 2 means R and the 0 means
 // that it is coplanar
 double CVUniverse::GetALRTrue(TruePionIdx idx) const {
-  TVector3 NeuDir(GetVecElem("mc_incomingPartVec", 0),
-                  GetVecElem("mc_incomingPartVec", 1),
-                  GetVecElem("mc_incomingPartVec", 2));
+  TVector3 NeuDir(Read(branches::kMcIncomingPartVec, 0),
+                  Read(branches::kMcIncomingPartVec, 1),
+                  Read(branches::kMcIncomingPartVec, 2));
   TVector3 MuDir(GetPXmuTrue(), GetPYmuTrue(), GetPZmuTrue());
-  TVector3 PiDir(GetVecElem("truth_pi_px", idx), GetVecElem("truth_pi_py", idx),
-                 GetVecElem("truth_pi_pz", idx));
+  TVector3 PiDir(Read(branches::kTruthPiPx, idx),
+                 Read(branches::kTruthPiPy, idx),
+                 Read(branches::kTruthPiPz, idx));
   TVector3 PlaneDir = NeuDir.Cross(MuDir);
   double proy = PlaneDir.Dot(PiDir);
   if (proy == 0) return 0.1;
@@ -455,14 +593,15 @@ double CVUniverse::GetALRTrue(TruePionIdx idx) const {
 double CVUniverse::GetAdlerCosThetaTrue(TruePionIdx idx) const {
   double mumom = GetPlepTrue();
   double Enu = GetEnuTrue();
-  TVector3 NeuDir(GetVecElem("mc_incomingPartVec", 0),
-                  GetVecElem("mc_incomingPartVec", 1),
-                  GetVecElem("mc_incomingPartVec", 2));
+  TVector3 NeuDir(Read(branches::kMcIncomingPartVec, 0),
+                  Read(branches::kMcIncomingPartVec, 1),
+                  Read(branches::kMcIncomingPartVec, 2));
   NeuDir = NeuDir.Unit();
   TVector3 MuDir(GetPXmuTrue(), GetPYmuTrue(), GetPZmuTrue());
   MuDir = MuDir.Unit();
-  TVector3 PiDir(GetVecElem("truth_pi_px", idx), GetVecElem("truth_pi_py", idx),
-                 GetVecElem("truth_pi_pz", idx));
+  TVector3 PiDir(Read(branches::kTruthPiPx, idx),
+                 Read(branches::kTruthPiPy, idx),
+                 Read(branches::kTruthPiPz, idx));
   double pimom = PiDir.Mag();
   PiDir = PiDir.Unit();
   TVector3 AdAngle = AdlerAngle(2, mumom /*GeV*/, pimom /*GeV*/, NeuDir, MuDir,
@@ -473,14 +612,15 @@ double CVUniverse::GetAdlerCosThetaTrue(TruePionIdx idx) const {
 double CVUniverse::GetAdlerPhiTrue(TruePionIdx idx) const {
   double mumom = GetPlepTrue();
   double Enu = GetEnuTrue();
-  TVector3 NeuDir(GetVecElem("mc_incomingPartVec", 0),
-                  GetVecElem("mc_incomingPartVec", 1),
-                  GetVecElem("mc_incomingPartVec", 2));
+  TVector3 NeuDir(Read(branches::kMcIncomingPartVec, 0),
+                  Read(branches::kMcIncomingPartVec, 1),
+                  Read(branches::kMcIncomingPartVec, 2));
   NeuDir = NeuDir.Unit();
   TVector3 MuDir(GetPXmuTrue(), GetPYmuTrue(), GetPZmuTrue());
   MuDir = MuDir.Unit();
-  TVector3 PiDir(GetVecElem("truth_pi_px", idx), GetVecElem("truth_pi_py", idx),
-                 GetVecElem("truth_pi_pz", idx));
+  TVector3 PiDir(Read(branches::kTruthPiPx, idx),
+                 Read(branches::kTruthPiPy, idx),
+                 Read(branches::kTruthPiPz, idx));
   double pimom = PiDir.Mag();
   PiDir = PiDir.Unit();
   TVector3 AdAngle = AdlerAngle(2, mumom /*GeV*/, pimom /*GeV*/, NeuDir, MuDir,
@@ -493,9 +633,9 @@ double CVUniverse::GetAdlerPhiTrue(TruePionIdx idx) const {
 double CVUniverse::GetAllTrackEnergyTrue() const {
   double etracks = 0;
   for (const auto& pi_idx : GetPionCandidates()) {
-    etracks += GetVecElem("MasterAnaDev_hadron_tm_beginKE", pi_idx);
+    etracks += Read(branches::kMasterAnaDevHadronTmBeginKE, pi_idx);
     // std::cout << GetVecElem("MasterAnaDev_hadron_tm_PDGCode", pi_idx) << " ";
-    if (abs(GetVecElem("MasterAnaDev_hadron_tm_PDGCode", pi_idx)) ==
+    if (abs(Read(branches::kMasterAnaDevHadronTmPDGCode, pi_idx)) ==
         211)  // TODO may want to only not add pion mass when is proton or
               // neutron
       etracks += CCNuPionIncConsts::CHARGED_PION_MASS;
@@ -506,16 +646,16 @@ double CVUniverse::GetAllTrackEnergyTrue() const {
 
 double CVUniverse::GetEmuTrue() const { return GetElepTrue(); }
 
-double CVUniverse::GetIntVtxXTrue() const { return GetVecElem("mc_vtx", 0); }
+double CVUniverse::GetIntVtxXTrue() const { return Read(branches::kMcVtx, 0); }
 
-double CVUniverse::GetIntVtxYTrue() const { return GetVecElem("mc_vtx", 1); }
+double CVUniverse::GetIntVtxYTrue() const { return Read(branches::kMcVtx, 1); }
 
-double CVUniverse::GetIntVtxZTrue() const { return GetVecElem("mc_vtx", 2); }
+double CVUniverse::GetIntVtxZTrue() const { return Read(branches::kMcVtx, 2); }
 
 double CVUniverse::GetPTTrue(TruePionIdx idx) const {
   TVector3 pT_mu(GetPXmuTrue(), GetPYmuTrue(), 0);
-  TVector3 pT_pi(GetVecElem("truth_pi_px", idx), GetVecElem("truth_pi_py", idx),
-                 0);
+  TVector3 pT_pi(Read(branches::kTruthPiPx, idx),
+                 Read(branches::kTruthPiPy, idx), 0);
   TVector3 pT = pT_mu + pT_pi;
   return pT.Mag();
 }
@@ -525,11 +665,11 @@ double CVUniverse::GetPTmuTrue() const {
 }
 
 double CVUniverse::GetPXmuTrue() const {
-  return GetVecElem("mc_primFSLepton", 0);
+  return Read(branches::kMcPrimFSLepton, 0);
 }
 
 double CVUniverse::GetPYmuTrue() const {
-  return GetVecElem("mc_primFSLepton", 1);
+  return Read(branches::kMcPrimFSLepton, 1);
 }
 
 double CVUniverse::GetPZmuTrue() const {
@@ -548,7 +688,7 @@ double CVUniverse::GetThetamuTrueDeg() const {
 
 // input: truth index. output: may be pip or pim.
 double CVUniverse::GetThetapiTrue(TruePionIdx idx) const {
-  double t_pi_theta = GetVecElem("truth_pi_theta_wrtbeam", idx);
+  double t_pi_theta = Read(branches::kTruthPiThetaWrtbeam, idx);
   if (t_pi_theta == -9.0) {
     std::cerr << "CVU::GetThetapiTrue: Default angle.\n"
                  "Tried to access truth pion angle for a nonexistent "
@@ -572,7 +712,7 @@ double CVUniverse::GetThetapiTrueDeg(TruePionIdx idx) const {
 // and output.
 // input: truth index. output: may be pip or pim.
 double CVUniverse::GetTpiTrue(TruePionIdx idx) const {
-  double t_pi_E = GetVecElem("truth_pi_E", idx);
+  double t_pi_E = Read(branches::kTruthPiE, idx);
   if (t_pi_E == -1.) {
     std::cerr << "CVU::GetTpiTrue: Default energy.\n"
                  "Tried to access truth pion energy for a nonexistent "
@@ -586,25 +726,26 @@ double CVUniverse::GetWexpTrue() const {
   return CalcWexp(GetQ2True(), GetEhadTrue());
 }
 
-double CVUniverse::GetWgenie() const { return GetDouble("mc_w"); }
+double CVUniverse::GetWgenie() const { return Read(branches::kMcW); }
 
 double CVUniverse::GetpimuAngleTrue(
     TruePionIdx idx) const {  // Angle beetwen P_pi and P_mu (degrees)
   TVector3 p_mu(GetPXmuTrue(), GetPYmuTrue(), GetPZmuTrue());
-  TVector3 p_pi(GetVecElem("truth_pi_px", idx), GetVecElem("truth_pi_py", idx),
-                GetVecElem("truth_pi_pz", idx));
+  TVector3 p_pi(Read(branches::kTruthPiPx, idx),
+                Read(branches::kTruthPiPy, idx),
+                Read(branches::kTruthPiPz, idx));
   double PidotMu = p_pi.Dot(p_mu);
   double Pmu = p_mu.Mag(), Ppi = p_pi.Mag();
   return ConvertRadToDeg(acos((PidotMu) / (Pmu * Ppi)));
 }
 
 int CVUniverse::GetNChargedPionsTrue() const {
-  return GetInt("truth_N_pip") + GetInt("truth_N_pim");
+  return ReadInt(branches::kTruthNPip) + ReadInt(branches::kTruthNPim);
 }
 
 // input: truth index. output: may be pip or pim.
 int CVUniverse::GetPiChargeTrue(TruePionIdx idx) const {
-  int t_pi_charge = GetVecElem("truth_pi_charge", idx);
+  int t_pi_charge = Read(branches::kTruthPiCharge, idx);
   if (t_pi_charge == 0) {
     std::cerr << "CVU::GetPiChargeTrue: Default charge.\n"
                  "Tried to access truth pion charge for a nonexistent "
@@ -691,7 +832,7 @@ double CVUniverse::GetMixedThetapiTrueDeg(TruePionIdx idx) const {
 // NukeCCPion_pion_recoilE_passive =
 // m_caloUtils->applyCalConsts(hadronProng,"Default",true,true);
 double CVUniverse::GetCalEpi(int iProng) const {
-  return GetVecElem("MasterAnaDev_hadron_pion_E_recoil_corr", iProng);
+  return Read(branches::kMasterAnaDevHadronPionERecoilCorr, iProng);
 }
 
 // Untracked recoil energy
@@ -757,12 +898,12 @@ double CVUniverse::GetCalRecoilEnergyNoPi_DefaultSpline() const {
 // RecoilUtils->calcRecoilEFromClusters(event, muonProng,
 // "NukeCCPion_TwoTrack_Nu_Tracker");
 double CVUniverse::GetCalRecoilEnergy_CCPiSpline() const {
-  return GetDouble("MasterAnaDev_hadron_recoil_two_track");
+  return Read(branches::kMasterAnaDevHadronRecoilTwoTrack);
 }
 
 // RecoilUtils->calcRecoilEFromClusters(event, muonProng, "Default" );
 double CVUniverse::GetCalRecoilEnergy_DefaultSpline() const {
-  return GetDouble("MasterAnaDev_hadron_recoil_default");
+  return Read(branches::kMasterAnaDevHadronRecoilDefault);
 }
 
 // This is what the response universe calls our tracked recoil energy
@@ -822,7 +963,7 @@ double CVUniverse::GetCalRecoilEnergyNoPi_CCIncSpline() const {
 // Ehad CCInclusive Spline Variables
 // Ehad ccinclusive splines -- doesn't account for pion
 double CVUniverse::GetCalRecoilEnergy_CCIncSpline() const {
-  return GetDouble("MasterAnaDev_hadron_recoil_CCInc");
+  return Read(branches::kMasterAnaDevHadronRecoilCCInc);
 }
 
 //==============================
@@ -851,7 +992,7 @@ double CVUniverse::GetTpiTrueMatched(RecoPionIdx hadron) const {
   // hadron); int true_pdg   = GetVecElem("MasterAnaDev_hadron_tm_PDGCode",
   // hadron); if(true_pdg != 211) std::cout << "pion mis-identified as a " <<
   // true_pdg << "!\n";
-  return GetVecElem("MasterAnaDev_hadron_tm_beginKE", hadron);
+  return Read(branches::kMasterAnaDevHadronTmBeginKE, hadron);
 }
 
 //==============================================================================
@@ -874,13 +1015,14 @@ bool CVUniverse::IsInHexagon(double x, double y, double apothem) const {
 }
 
 bool CVUniverse::IsInPlastic() const {
-  if (!IsInHexagon(GetVecElem("mc_vtx", 0), GetVecElem("mc_vtx", 1), 1000.0))
+  if (!IsInHexagon(Read(branches::kMcVtx, 0), Read(branches::kMcVtx, 1),
+                   1000.0))
     return false;  // This is in the calorimeters
 
-  double mc_vtx_z = GetVecElem("mc_vtx", 2);
+  double mc_vtx_z = Read(branches::kMcVtx, 2);
   if (mc_vtx_z > 8467.0) return false;  // Ditto
 
-  int mc_nuclei = GetInt("mc_targetZ");
+  int mc_nuclei = ReadInt(branches::kMcTargetZ);
   // In the carbon target?  The z is gotten from NukeBinningUtils
   if (fabs(mc_vtx_z - 4945.92) <=
           PlotUtils::TargetProp::ThicknessMC::Tgt3::C / 2 &&
@@ -899,15 +1041,15 @@ bool CVUniverse::IsInPlastic() const {
 }
 
 double CVUniverse::GetEmichel(RecoPionIdx hadron) const {
-  return GetVecElem("has_michel_cal_energy", hadron);
+  return Read(branches::kHasMichelCalEnergy, hadron);
 }
 
 double CVUniverse::GetEnode0(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q0", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ0, hadron);
 }
 
 double CVUniverse::GetEnode1(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q1", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ1, hadron);
 }
 
 double CVUniverse::GetEnode01(RecoPionIdx hadron) const {
@@ -915,35 +1057,35 @@ double CVUniverse::GetEnode01(RecoPionIdx hadron) const {
 }
 
 double CVUniverse::GetEnode2(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q2", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ2, hadron);
 }
 
 double CVUniverse::GetEnode3(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q3", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ3, hadron);
 }
 
 double CVUniverse::GetEnode4(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q4", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ4, hadron);
 }
 
 double CVUniverse::GetEnode5(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_lastnode_Q5", hadron);
+  return Read(branches::kMasterAnaDevPionLastnodeQ5, hadron);
 }
 
 double CVUniverse::GetPpionCorr(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_hadron_pion_p_corr", hadron);
+  return Read(branches::kMasterAnaDevHadronPionPCorr, hadron);
 }
 
 double CVUniverse::GetFitVtxX() const {
-  return GetVecElem("MasterAnaDev_vtx", 0);
+  return Read(branches::kMasterAnaDevVtx, 0);
 }  // cm?
 
 double CVUniverse::GetFitVtxY() const {
-  return GetVecElem("MasterAnaDev_vtx", 1);
+  return Read(branches::kMasterAnaDevVtx, 1);
 }  // cm?
 
 double CVUniverse::GetFitVtxZ() const {
-  return GetVecElem("MasterAnaDev_vtx", 2);
+  return Read(branches::kMasterAnaDevVtx, 2);
 }  // cm?
 
 double CVUniverse::GetLLRScore(RecoPionIdx hadron) const {
@@ -959,7 +1101,7 @@ double CVUniverse::GetLLRScore(RecoPionIdx hadron) const {
     return -1;
     // throw hadron;
   }
-  return GetVecElem("MasterAnaDev_hadron_piFit_scoreLLR", hadron);
+  return Read(branches::kMasterAnaDevHadronPiFitScoreLLR, hadron);
 }
 
 double CVUniverse::GetLargestIsoProngSep() const {
@@ -982,13 +1124,13 @@ double CVUniverse::GetTpiFResidual(const int hadron) const {
   // double T_reco = !MBR ? GetMixedTpi(hadron) : GetTpiMBR(hadron);
   double T_reco = GetMixedTpi(hadron);
   int true_index = -1;
-  true_index = GetVecElem("MasterAnaDev_hadron_tm_trackID", hadron);
-  double T_true = GetVecElem("MasterAnaDev_hadron_tm_beginKE", hadron);
+  true_index = Read(branches::kMasterAnaDevHadronTmTrackID, hadron);
+  double T_true = Read(branches::kMasterAnaDevHadronTmBeginKE, hadron);
   double fresid =
       (!std::isfinite(T_reco / T_true) || (std::abs(T_reco / T_true)) > 10000)
           ? 0.96
           : T_reco / T_true - 1.;
-  int true_pdg = GetVecElem("MasterAnaDev_hadron_tm_PDGCode", hadron);
+  int true_pdg = Read(branches::kMasterAnaDevHadronTmPDGCode, hadron);
   return fresid;
 }
 
@@ -1004,39 +1146,39 @@ double CVUniverse::GetdEdxScore(RecoPionIdx hadron) const {
                  "In that case, this function won't make sense.\n";
     throw hadron;
   }
-  return GetVecElem("MasterAnaDev_hadron_piFit_score1", hadron);
+  return Read(branches::kMasterAnaDevHadronPiFitScore1, hadron);
 }
 
 int CVUniverse::GetNAnchoredLongTracks() const {
-  return GetInt("n_anchored_long_trk_prongs");
+  return ReadInt(branches::kNAnchoredLongTrkProngs);
 }
 
 int CVUniverse::GetNAnchoredShortTracks() const {
-  return GetInt("n_anchored_short_trk_prongs");
+  return ReadInt(branches::kNAnchoredShortTrkProngs);
 }
 
 int CVUniverse::GetNIsoProngs() const {
-  return GetDouble("n_nonvtx_iso_blobs_all");
+  return Read(branches::kNNonvtxIsoBlobsAll);
   //  return GetDouble("iso_prongs_count");// branch for p3
 }
 
 int CVUniverse::GetNNodes(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_pion_nNodes", hadron);
+  return Read(branches::kMasterAnaDevPionNNodes, hadron);
 }
 
 int CVUniverse::GetNhadrons() const {
-  return GetInt("MasterAnaDev_hadron_number");
+  return ReadInt(branches::kMasterAnaDevHadronNumber);
 }
 
 int CVUniverse::GetTrackReconstructionMethod(RecoPionIdx hadron) const {
-  return GetVecElem("MasterAnaDev_hadron_1stTrackPatRec", hadron);
+  return Read(branches::kMasterAnaDevHadron1stTrackPatRec, hadron);
 }
 
 //==============================================================================
 // Weights
 //==============================================================================
 double CVUniverse::GetAnisoDeltaDecayWarpWeight() const {
-  return GetVecElem("truth_genie_wgt_Theta_Delta2Npi", 4);
+  return Read(branches::kTruthGenieWgtThetaDelta2Npi, 4);
 }
 
 // Note, this assumes you're not using the diffractive model in GENIE
@@ -1045,7 +1187,7 @@ double CVUniverse::GetAnisoDeltaDecayWarpWeight() const {
 // (diffractive is coherent on hydrogen) by 1.4368.
 // Coherent xsec scales by A^(1/3), and 1/(12^(1/3)) = 0.4368
 double CVUniverse::GetDiffractiveWeight() const {
-  if (GetInt("mc_intType") != 4) return 1.;
+  if (ReadInt(branches::kMcIntType) != 4) return 1.;
   // Note: diffractive should be applied only to plastic. This approximates that
   // if( PlotUtils::TargetUtils::Get().InCarbon3VolMC( GetVecElem("mc_vtx",0),
   //                                 GetVecElem("mc_vtx",1),
@@ -1053,7 +1195,7 @@ double CVUniverse::GetDiffractiveWeight() const {
   // if( GetInt("mc_nucleiZ") != 6 ) 1.;
   if (!IsInPlastic() && !PlotUtils::TargetUtils::Get().InWaterTargetMC(
                             GetIntVtxXTrue(), GetIntVtxYTrue(),
-                            GetIntVtxZTrue(), GetInt("mc_targetZ")))
+                            GetIntVtxZTrue(), ReadInt(branches::kMcTargetZ)))
     return 1.;
 
   return 1.4368;
@@ -1062,7 +1204,7 @@ double CVUniverse::GetDiffractiveWeight() const {
 double CVUniverse::GetGenieWarpWeight(
     double p) const {  // p is the factor that
                        // the weight is modified
-  double wgt = GetVecElem("truth_genie_wgt_MaRES", 4);
+  double wgt = Read(branches::kTruthGenieWgtMaRES, 4);
   wgt = 1 + (wgt - 1) *
                 p;  // double the size of the shift from 1 (e.g. 1.1 --> 1.2)
   return wgt;
@@ -1079,81 +1221,80 @@ double CVUniverse::GetLowQ2PiWeight(double q2, std::string channel) const {
     return PlotUtils::weight_lowq2pi().getWeight(q2, channel, +1);
 }
 
-double CVUniverse::GetWeight() const {
-  // Warping strategy is to only turn on one of these at a time.
-  const bool do_genie_warping = false;  // we are not using this werp anymore
-  const bool do_aniso_warping = false;
-  const bool do_mk_warping = false;
-  const bool do_MARESFrac_warping = false;
-  const bool do_tpi_warping = false;
-  const bool closureTest = false;
-
-  double wgt_flux = 1., wgt_2p2h = 1.;
-  double wgt_rpa = 1., wgt_lowq2 = 1.;
-  double wgt_genie = 1., wgt_mueff = 1.;
-  double wgt_anisodd = 1.;
-  double wgt_michel = 1.;
-  double wgt_diffractive = 1.;
-  double wgt_mk = 1.;
-  double wgt_target = 1.;
-  double wgt_CCPiWegiht = 1.;
-  double wgt_fsi = 1., wgt_coh = 1., wgt_geant = 1.,
-         wgt_sbfit = 1. /* This weight depends of the sidebands, Will we applay
-                           this weight?*/
-      ;
-  double wgt_pionReweight = 1.;
-  double wgt_tpi_warp = 1.;
-  // genie
-  wgt_genie = GetGenieWeight();
-  if (do_genie_warping) wgt_genie = GetGenieWarpWeight(2.);
-  if (do_MARESFrac_warping) wgt_genie = GetGenieWarpWeight(0.2);
-
-  // flux
-
-  wgt_flux = GetFluxAndCVWeight();
-
-  // rpa
-  wgt_rpa = GetRPAWeight();
-  if (!closureTest) {
-    // MINOS efficiency
-    if (!m_is_truth && GetInt("isMinosMatchTrack") == 1 &&
-        GetInt("MasterAnaDev_nuHelicity") == 1) {  // Remove for closure test
-      wgt_mueff = GetMinosEfficiencyWeight();
-    }
+namespace {
+// The CV's weight: no warps
+const CVUniverse::WeightConfig kCVWeightConfig = CVUniverse::WeightConfig();
+}  // namespace
+
+double CVUniverse::GetWeightFactor(const EWeightFactor factor) const {
+  return GetWeightFactor(factor, kCVWeightConfig);
+}
+
+// One factor of the event weight. Factors left out (closure test, warping
+// off) are 1.
+double CVUniverse::GetWeightFactor(const EWeightFactor factor,
+                                   const WeightConfig& config) const {
+  const bool closureTest = config.closure_test;
+  switch (factor) {
+    // genie
+    case kGenieWgt:
+      if (config.maresfrac_warp) return GetGenieWarpWeight(0.2);
+      if (config.genie_warp) return GetGenieWarpWeight(2.);
+      return GetGenieWeight();
+
+    // flux
+    case kFluxWgt:
+      return GetFluxAndCVWeight();
+
+    // rpa
+    case kRPAWgt:
+      return GetRPAWeight();
+
     // 2p2h
-    wgt_2p2h = GetLowRecoil2p2hWeight();
+    case k2p2hWgt:
+      return closureTest ? 1. : GetLowRecoil2p2hWeight();
 
     // low q2
-    wgt_lowq2 = (GetQ2True() > 0)  // remove for closure test
-                    ? GetLowQ2PiWeight(CCNuPionIncShifts::kLowQ2PiChannel)
-                    : 1.;
+    case kLowQ2Wgt:
+      if (closureTest || GetQ2True() <= 0) return 1.;
+      return GetLowQ2PiWeight(CCNuPionIncShifts::kLowQ2PiChannel);
+
+    // MINOS efficiency
+    case kMuEffWgt:
+      if (!closureTest && !m_is_truth &&
+          ReadInt(branches::kIsMinosMatchTrack) == 1 &&
+          ReadInt(branches::kMasterAnaDevNuHelicity) == 1)
+        return GetMinosEfficiencyWeight();
+      return 1.;
 
     // aniso delta decay weight -- currently being used for warping
-    if (do_aniso_warping)
-      wgt_anisodd = GetVecElem("truth_genie_wgt_Theta_Delta2Npi", 4);
+    case kAnisoDDWgt:
+      if (!closureTest && config.aniso_warp)
+        return Read(branches::kTruthGenieWgtThetaDelta2Npi, 4);
+      return 1.;
 
     // Michel efficiency
-    wgt_michel = GetMichelEfficiencyWeight();  // remove for closure test
+    case kMichelWgt:
+      return closureTest ? 1. : GetMichelEfficiencyWeight();
 
     // Diffractive
-    wgt_diffractive = GetDiffractiveWeight();  // remove for closure test
+    case kDiffractiveWgt:
+      return closureTest ? 1. : GetDiffractiveWeight();
 
     // MK Weight
-    if (do_mk_warping) wgt_mk = GetMKWeight();
+    case kMKWgt:
+      return (!closureTest && config.mk_warp) ? GetMKWeight() : 1.;
 
     // Target Mass
-    wgt_target = GetTargetMassWeight();  // remove for closure test
-
-    // Tpi Mehreen's weight
-    wgt_pionReweight = GetUntrackedPionWeight();  // remove for closure test
-
-    if (do_tpi_warping) wgt_tpi_warp = 0.8 + 0.2 * wgt_pionReweight;
+    case kTargetWgt:
+      return closureTest ? 1. : GetTargetMassWeight();
 
     // New Weights added taking as reference Aaron's weights
+    case kFSIWgt:
+      return closureTest ? 1. : GetFSIWeight(0);
 
-    wgt_fsi = GetFSIWeight(0);  // Remove for closure test
-
-    if (GetInt("mc_intType") == 4) {  // Remove for closure test
+    case kCoherentWgt: {
+      if (closureTest || ReadInt(branches::kMcIntType) != 4) return 1.;
       int idx = (int)GetHighestEnergyTruePionIndex();
       if (GetNChargedPionsTrue() > 1)
         std::cout << " More that one charge pion in Coherent events "
@@ -1161,16 +1302,70 @@ double CVUniverse::GetWeight() const {
                   << GetHighestEnergyTruePionIndex() << "\n";
       double deg_theta_pi = GetThetapiTrueDeg(idx);
       if (GetTpiTrue(idx) > 0.)
-        wgt_coh *= GetCoherentPiWeight(
+        return GetCoherentPiWeight(
             deg_theta_pi, (GetTpiTrue(idx) + MinervaUnits::M_pion) / 1000);
+      return 1.;
     }
 
-    wgt_geant = GetGeantHadronWeight();  // Remove for closure test
+    case kGeantWgt:
+      return closureTest ? 1. : GetGeantHadronWeight();
+
+    // This weight depends of the sidebands, Will we applay this weight?
+    case kSidebandFitWgt:
+      return 1.;
+
+    // Tpi Mehreen's weight
+    case kPionReweightWgt:
+      return closureTest ? 1. : GetUntrackedPionWeight();
+
+    case kTpiWarpWgt:
+      if (closureTest || !config.tpi_warp) return 1.;
+      return 0.8 + 0.2 * GetUntrackedPionWeight();
+
+    // if (m_is_signal && !IsTruth()) wgt_CCPiWegiht = GetChargedPionTuneWeight();
+    case kChargedPionTuneWgt:
+      return m_is_signal ? GetChargedPionTuneWeight() : 1.;
+
+    default:
+      std::cerr << "CVUniverse::GetWeightFactor: unknown factor " << factor
+                << "\n";
+      std::exit(1);
   }
+}
+
+CVUniverse::WeightFactors CVUniverse::GetWeightFactors() const {
+  return GetWeightFactors(kCVWeightConfig);
+}
 
-  // if (m_is_signal && !IsTruth()) wgt_CCPiWegiht = GetChargedPionTuneWeight();
-  if (m_is_signal) wgt_CCPiWegiht = GetChargedPionTuneWeight();
-  // wgt_CCPiWegiht = GetChargedPionTuneWeight();
+CVUniverse::WeightFactors CVUniverse::GetWeightFactors(
+    const WeightConfig& config) const {
+  WeightFactors factors;
+  for (int i = 0; i < kNWeightFactors; ++i)
+    factors[i] = GetWeightFactor(static_cast<EWeightFactor>(i), config);
+  return factors;
+}
+
+// Same multiplication order as the unfactorized weight always used, so the
+// product is bit-for-bit what it was.
+double CVUniverse::MultiplyWeightFactors(const WeightFactors& f) {
+  double wgt = f[0];
+  for (int i = 1; i < kNWeightFactors; ++i) wgt *= f[i];
+  return wgt;
+}
+
+// GetWeightFactors skips some reweighters for some entries (and warps), so
+// use those ones directly.
+void CVUniverse::InitializeReweighters() const {
+  GetWeightFactors();
+  GetLowQ2PiWeight(CCNuPionIncShifts::kLowQ2PiChannel);
+  if (!m_is_truth) GetMinosEfficiencyWeight();
+  GetMKWeight();
+  GetCoherentPiWeight(10., 1.);
+  GetChargedPionTuneWeight();
+  PlotUtils::TargetUtils::Get();
+}
+
+double CVUniverse::GetWeight() const {
   /*  std::cout << "GENIE " << wgt_genie << " Flux " <<  wgt_flux << " 2p2h " <<
               wgt_2p2h << " RPA " << wgt_rpa << " LowQ2 " <<  wgt_lowq2 <<
               " MuEff " << wgt_mueff << " Michel " << wgt_michel << "
@@ -1181,11 +1376,7 @@ double CVUniverse::GetWeight() const {
      << wgt_sbfit << " PionReweght " << wgt_pionReweight << " Anisodd " <<
               wgt_anisodd << " MK " << wgt_mk << "\n";
   */
-
-  return wgt_genie * wgt_flux * wgt_2p2h * wgt_rpa * wgt_lowq2 * wgt_mueff *
-         wgt_anisodd * wgt_michel * wgt_diffractive * wgt_mk * wgt_target *
-         wgt_fsi * wgt_coh * wgt_geant * wgt_sbfit * wgt_pionReweight *
-         wgt_tpi_warp * wgt_CCPiWegiht;
+  return MultiplyWeightFactors(GetWeightFactors());
 }
 
 //==============================================================================
@@ -3,18 +3,65 @@
 
 #include <TVector3.h>
 
+#include <array>
+#include <memory>
+
 #include "Binning.h"    // CCPi::GetBinning for ehad_nopi
+#include "BranchHandle.h"
 #include "Constants.h"  // CCNuPionIncConsts, CCNuPionIncShifts, Reco/TruePionIdx
+#include "HadronQuality.h"
 #include "PlotUtils/ChainWrapper.h"
 #include "PlotUtils/LowRecoilPionReco.h"
 #include "PlotUtils/MinervaUniverse.h"
 
 class CVUniverse : public PlotUtils::MinervaUniverse {
  private:
+  // This universe's chain's pre-resolved branches, shared with the other
+  // universes of the chain
+  std::shared_ptr<BranchRegistry> m_branches;
+
+  // See GetShiftedWeightFactor
+  int m_shifted_weight_factor;
+
   // Pion Candidates - clear these when SetEntry is called
   std::vector<RecoPionIdx> m_pion_candidates;
   LowRecoilPion::MichelEvent<CVUniverse> m_vtx_michels;
 
+  // The CV's pion candidate track cut results for this entry. Not owned.
+  // Cleared when SetEntry is called.
+  const hadron_quality::HadronQualityCache* m_hadron_quality;
+
+  // Per-entry cache of event-wide reco kinematics. Wexp, Q2, Enu, and Ehad
+  // call each other and are asked for by many variables, so compute each at
+  // most once per entry. Values come from this universe's own (virtual)
+  // getters, so lateral shifts are cached per universe. Cleared when a new
+  // entry is loaded, and whenever pion candidates, vtx michels, or cut flags
+  // are set.
+  struct KinematicsCache {
+    bool has_tracked_ehad = false;
+    bool has_trackless_ehad = false;
+    bool has_ehad = false;
+    bool has_enu = false;
+    bool has_q2 = false;
+    bool has_wexp = false;
+    bool has_tracked_wexp = false;
+    bool has_trackless_wexp = false;
+    double tracked_ehad = 0.;
+    double trackless_ehad = 0.;
+    double ehad = 0.;
+    double enu = 0.;
+    double q2 = 0.;
+    double wexp = 0.;
+    double tracked_wexp = 0.;
+    double trackless_wexp = 0.;
+  };
+  mutable KinematicsCache m_kinematics_cache;
+  void ClearKinematicsCache() { m_kinematics_cache = KinematicsCache(); }
+
+  // Ehad as used in the tracked and the trackless (untracked) selections
+  double GetTrackedEhad() const;
+  double GetTracklessEhad() const;
+
  public:
 #include "PlotUtils/LowRecoilPionFunctions.h"
 #include "PlotUtils/MichelFunctions.h"
@@ -31,6 +78,24 @@ class CVUniverse : public PlotUtils::MinervaUniverse {
   // Print arachne link
   void PrintArachneLink() const;
 
+  // MC event ID, as in the arachne link. Same in the reco and truth trees.
+  int GetMCRun() const;
+  int GetMCSubrun() const;
+  int GetMCGate() const;
+
+  // Tuple reads through pre-resolved branches (see BranchHandle.h). Same
+  // values as GetVecElem/GetDouble and GetVecElemInt/GetInt.
+  double Read(const BranchHandle& branch, const int i = 0) const {
+    return m_branches->Get(branch, m_entry, i);
+  }
+  int ReadInt(const BranchHandle& branch, const int i = 0) const {
+    return (int)Read(branch, i);
+  }
+  // Number of elements of an array branch, like GetVec(...).size()
+  int ReadLength(const BranchHandle& branch) const {
+    return m_branches->GetLength(branch, m_entry);
+  }
+
   // Dummy access for variable constructors
   virtual double GetDummyVar() const;
   virtual double GetDummyHadVar(const int x) const;
@@ -46,9 +111,11 @@ class CVUniverse : public PlotUtils::MinervaUniverse {
 
   // No stale cache!
   virtual void OnNewEntry() override {
+    ClearKinematicsCache();
     m_pion_candidates.clear();
     m_vtx_michels = LowRecoilPion::MichelEvent<CVUniverse>();
     assert(m_vtx_michels.m_idx == -1);
+    m_hadron_quality = nullptr;
     m_passesTrackedCuts = false;
     m_passesTracklessCuts = false;
     m_passesTrackedSideband = false;
@@ -69,10 +136,22 @@ class CVUniverse : public PlotUtils::MinervaUniverse {
   void SetPionCandidates(std::vector<RecoPionIdx> c);
   void SetVtxMichels(const LowRecoilPion::MichelEvent<CVUniverse>& m) {
     m_vtx_michels = m;
+    ClearKinematicsCache();
   }
   LowRecoilPion::MichelEvent<CVUniverse> GetVtxMichels() const {
     return m_vtx_michels;
   }
+  // Set after SetEntry, see HadronQuality.h
+  void SetHadronQuality(const hadron_quality::HadronQualityCache* cache) {
+    m_hadron_quality = cache;
+  }
+  const hadron_quality::HadronQualityCache* GetHadronQuality() const {
+    return m_hadron_quality;
+  }
+  // Pion candidate track cuts that this universe's shift changes, as a mask
+  // of hadron_quality::Bit(cut). Override alongside GetLLRScore, GetEnode*,
+  // GetPpionCorr, or the hadron track flags.
+  virtual unsigned int GetShiftedHadronCuts() const { return 0u; }
   void SetPassesTrakedTracklessCuts(
       bool passesTrackedCuts, bool passesTracklessCuts, bool tracked_sideband,
       bool trackless_sideband, bool tracked_all_ex_w, bool trackless_all_ex_w);
@@ -215,6 +294,64 @@ class CVUniverse : public PlotUtils::MinervaUniverse {
   virtual double GetLowQ2PiWeight(double q2, std::string channel) const;
   virtual double GetWeight() const;
 
+  // The event weight, one factor at a time. GetWeight() is the product of
+  // all factors in this order. A universe that shifts a single factor has
+  // the CV's weight with only that factor swapped (see FactorizedWeight.h).
+  enum EWeightFactor {
+    kGenieWgt,
+    kFluxWgt,
+    k2p2hWgt,
+    kRPAWgt,
+    kLowQ2Wgt,
+    kMuEffWgt,
+    kAnisoDDWgt,
+    kMichelWgt,
+    kDiffractiveWgt,
+    kMKWgt,
+    kTargetWgt,
+    kFSIWgt,
+    kCoherentWgt,
+    kGeantWgt,
+    kSidebandFitWgt,
+    kPionReweightWgt,
+    kTpiWarpWgt,
+    kChargedPionTuneWgt,
+    kNWeightFactors
+  };
+  typedef std::array<double, kNWeightFactors> WeightFactors;
+
+  // Reweights for warping studies, all off in the CV's weight. A warp
+  // replaces one factor; closure_test sets most of the tune's factors to 1.
+  // See WarpUniverse.h.
+  struct WeightConfig {
+    bool genie_warp = false;      // kGenieWgt: twice the MaRES shift
+    bool maresfrac_warp = false;  // kGenieWgt: 0.2 of the MaRES shift
+    bool aniso_warp = false;      // kAnisoDDWgt
+    bool mk_warp = false;         // kMKWgt
+    bool tpi_warp = false;        // kTpiWarpWgt
+    bool closure_test = false;
+  };
+  double GetWeightFactor(const EWeightFactor factor) const;
+  double GetWeightFactor(const EWeightFactor factor,
+                         const WeightConfig& config) const;
+  WeightFactors GetWeightFactors() const;
+  WeightFactors GetWeightFactors(const WeightConfig& config) const;
+  static double MultiplyWeightFactors(const WeightFactors& factors);
+
+  // The one weight factor this universe shifts, if its weight is the CV's
+  // with only that factor swapped, or -1 (the default). Declared by whoever
+  // makes the universe (see systematics::GetSystematicUniversesMap), or by an
+  // override. FactorizedWeight relies on it.
+  virtual int GetShiftedWeightFactor() const { return m_shifted_weight_factor; }
+  void SetShiftedWeightFactor(const int factor) {
+    m_shifted_weight_factor = factor;
+  }
+
+  // Use every reweighter that PlotUtils makes lazily, on first use, whether
+  // or not the entry needs it. Call on one thread, with an entry loaded,
+  // before several threads weight events.
+  void InitializeReweighters() const;
+
   //==============================================================================
   // Physics Calculations
   //==============================================================================
@@ -31,6 +31,9 @@ class DiffractiveUniverse : public CVUniverse {
                       double fracDiffUnc = fracDiffractiveUnc);
 
   virtual double GetDiffractiveWeight() const /*override*/;
+  virtual int GetShiftedWeightFactor() const /*override*/ {
+    return kDiffractiveWgt;
+  }
 
   virtual std::string ShortName() const /*override*/;
   virtual std::string LatexName() const /*override*/;
@@ -54,6 +57,9 @@ class CoherentPiPlasticUniverse : public CVUniverse {
   virtual double GetCoherentPiWeight(double thpi_true /*deg*/,
                                      double tpi_true /*GeV*/) const
       /*override*/;
+  virtual int GetShiftedWeightFactor() const /*override*/ {
+    return kCoherentWgt;
+  }
 
   virtual std::string ShortName() const /*override*/;
   virtual std::string LatexName() const /*override*/;
@@ -0,0 +1,50 @@
+#ifndef CounterRNG_h
+#define CounterRNG_h
+
+//==============================================================================
+// Counter-based random draws, keyed on the MC event.
+//
+// A draw is a hash of the event's MC run, subrun, and gate, and of a stream
+// number that tells apart the draws of one event. There is no generator state
+// to share, so universes can draw from any thread, and an event gets the same
+// draws in every loop, shard, and job that processes it.
+//==============================================================================
+#include <cmath>  // cos, ldexp, log, sqrt
+#include <cstdint>
+
+#include "CVUniverse.h"
+
+namespace counter_rng {
+// SplitMix64's finalizer
+inline uint64_t Mix(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+// Key of an MC event
+inline uint64_t GetEventKey(const int run, const int subrun, const int gate) {
+  return Mix(Mix(Mix(uint64_t(run)) ^ uint64_t(subrun)) ^ uint64_t(gate));
+}
+
+inline uint64_t GetEventKey(const CVUniverse& universe) {
+  return GetEventKey(universe.GetMCRun(), universe.GetMCSubrun(),
+                     universe.GetMCGate());
+}
+
+// Uniform in [0, 1)
+inline double Uniform(const uint64_t key, const uint64_t stream) {
+  const uint64_t bits = Mix(key ^ Mix(stream));
+  return std::ldexp(double(bits >> 11), -53);
+}
+
+// Gaussian(0, 1), by Box-Muller from two uniforms of the stream
+inline double Gaus(const uint64_t key, const uint64_t stream) {
+  const double u1 = 1. - Uniform(key, 2 * stream);  // in (0, 1]
+  const double u2 = Uniform(key, 2 * stream + 1);
+  return std::sqrt(-2. * std::log(u1)) * std::cos(2. * M_PI * u2);
+}
+}  // namespace counter_rng
+
+#endif  // CounterRNG_h
@@ -65,6 +65,14 @@ bool IsPrecut(ECuts c) {
     return false;
 }
 
+// Cuts that build or filter the michel containers. These depend on the cuts
+// before them, so their order within a cuts vector matters.
+bool IsMichelCut(ECuts c) {
+  return c == kAtLeastOneMichel || c == kLLR || c == kNode ||
+         c == kTrackQuality || c == kAtLeastOnePionCandidate ||
+         c == kPionMult || c == kGoodMomentum;
+}
+
 // Cut Names
 std::string GetCutName(ECuts cut) {
   switch (cut) {
@@ -37,11 +37,15 @@ A not-brief note on how the "exclusive" pion cuts work:
 
 #include "Cuts.h"
 
+#include <algorithm>  // stable_sort
+#include <chrono>
+
 #include "CutUtils.h"  // GetHadIdxsFromMichels, IsPrecut, GetWSidebandCuts, kCutsVector
 #include "Michel.h"  // endpoint::Michel, endpoint::MichelMap, endpoint::GetQualityMichels
 #include "PlotUtils/LowRecoilPionCuts.h"
 #include "PlotUtils/LowRecoilPionFunctions.h"
 #include "PlotUtils/LowRecoilPionReco.h"
+#include "Timing.h"  // timing::ScopedTimer
 #include "TruthCategories/Sidebands.h"  // sidebands::kSidebandCutVal
 #include "utilities.h"                  // ContainerEraser
 
@@ -51,12 +55,12 @@ A not-brief note on how the "exclusive" pion cuts work:
 // Get pion candidate indexes from michel map
 // (our cuts strategy enforces a 1-1 michel-pion candidate match)
 std::vector<int> GetHadIdxsFromMichels(
-    const endpoint::MichelMap endpoint_michels,
-    const LowRecoilPion::MichelEvent<CVUniverse> vtx_michels) {
+    const endpoint::MichelMap& endpoint_michels,
+    const LowRecoilPion::MichelEvent<CVUniverse>& vtx_michels) {
   std::vector<int> ret;
 
   // endpoint michels
-  for (auto m : endpoint_michels) ret.push_back(m.second.had_idx);
+  for (const auto& m : endpoint_michels) ret.push_back(m.second.had_idx);
 
   // vertex michels
   // When m_idx is set (i.e. != -1), then we have a good vertex michel.
@@ -78,31 +82,129 @@ std::vector<int> GetHadIdxsFromMichels(
 // If a track fails a cut, we remove the track's michel from the lists.
 // Then at the end, return the track indices.
 
+//==============================================================================
+// Cut pipeline
+//==============================================================================
+// The w sideband cuts, in the order that rejects events fastest.
+//
+// Eventwide cuts only read the universe, so they can be checked in any order.
+// For the first kNCalibration events, time each cut and count its failures;
+// then put the eventwide cuts in order of failures per nanosecond. Michel cuts
+// build on each other's michel containers, so they stay in their kCutsVector
+// order, after the eventwide cuts.
+//
+// One pipeline per thread, so timings never need a lock.
+namespace {
+class CutPipeline {
+ public:
+  static const int kNCalibration = 1000;
+
+  CutPipeline() : m_cuts(GetWSidebandCuts()), m_n_calls(0) {
+    m_stats.resize(m_cuts.size());
+    for (unsigned int i = 0; i < m_cuts.size(); ++i) m_order.push_back(i);
+    SortByRejectionRate();  // michel cuts to the back from the start
+  }
+
+  bool IsCalibrating() const { return m_n_calls < kNCalibration; }
+
+  // Position i of the pipeline
+  unsigned int Size() const { return m_order.size(); }
+  ECuts Cut(const unsigned int i) const { return m_cuts[m_order[i]]; }
+
+  // Apply the i-th cut of the pipeline, timing it while calibrating.
+  bool Apply(const unsigned int i, const CVUniverse& univ, const bool is_mc,
+             const SignalDefinition& signal_definition,
+             endpoint::MichelMap& endpoint_michels,
+             LowRecoilPion::MichelEvent<CVUniverse>& vtx_michels) {
+    if (!IsCalibrating())
+      return ApplyCut(univ, Cut(i), is_mc, signal_definition, endpoint_michels,
+                      vtx_michels);
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool pass = ApplyCut(univ, Cut(i), is_mc, signal_definition,
+                               endpoint_michels, vtx_michels);
+    const auto stop = std::chrono::steady_clock::now();
+    CutStats& stats = m_stats[m_order[i]];
+    stats.ns += std::chrono::duration<double, std::nano>(stop - start).count();
+    ++stats.n_checked;
+    if (!pass) ++stats.n_failed;
+    return pass;
+  }
+
+  // Call once per event
+  void EndEvent() {
+    if (!IsCalibrating()) return;
+    ++m_n_calls;
+    if (!IsCalibrating()) SortByRejectionRate();
+  }
+
+ private:
+  struct CutStats {
+    double ns = 0.;
+    int n_checked = 0;
+    int n_failed = 0;
+    double RejectionRate() const {
+      return n_checked > 0 && ns > 0. ? n_failed / ns : 0.;
+    }
+  };
+
+  void SortByRejectionRate() {
+    std::stable_sort(m_order.begin(), m_order.end(),
+                     [this](unsigned int a, unsigned int b) {
+                       const bool a_michel = IsMichelCut(m_cuts[a]);
+                       const bool b_michel = IsMichelCut(m_cuts[b]);
+                       if (a_michel || b_michel) return !a_michel && b_michel;
+                       return m_stats[a].RejectionRate() >
+                              m_stats[b].RejectionRate();
+                     });
+  }
+
+  const std::vector<ECuts> m_cuts;
+  std::vector<unsigned int> m_order;
+  std::vector<CutStats> m_stats;
+  int m_n_calls;
+};
+}  // namespace
+
 // NEW! Return passes_all_cuts, is_w_sideband, and pion_candidate_indices
 // Passes All Cuts v3 (latest and greatest)
 // return tuple {passes_all_cuts, is_w_sideband, pion_candidate_idxs}
+//
+// Stops at the first failed cut. Except, with need_pion_candidates, the
+// michel cuts are always applied, so that the pion candidates are the same as
+// if every cut had been checked. The cut flow is in ccpi_event::FillCounters.
 PassesCutsInfo PassesCuts(CVUniverse& universe, const bool is_mc,
                           const SignalDefinition signal_definition,
-                          std::vector<ECuts> cuts) {
+                          std::vector<ECuts> cuts,
+                          const bool need_pion_candidates) {
+  thread_local CutPipeline pipeline;
+
   //============================================================================
   // passes all cuts but w cut
   //============================================================================
   endpoint::MichelMap endpoint_michels;
   LowRecoilPion::MichelEvent<CVUniverse> vtx_michels;
   bool passes_all_cuts_except_w = true;
-  for (auto c : GetWSidebandCuts()) {
+  // Eventwide cuts don't look at the pion candidates
+  universe.SetPionCandidates(
+      GetHadIdxsFromMichels(endpoint_michels, vtx_michels));
+  for (unsigned int i = 0; i < pipeline.Size(); ++i) {
+    const bool is_michel_cut = IsMichelCut(pipeline.Cut(i));
+    if (!passes_all_cuts_except_w && !(need_pion_candidates && is_michel_cut))
+      continue;
+
     // Set the pion candidates to the universe. The values set in early cuts
     // are used for later cuts, which is why we assign them to the CVU.
-    universe.SetPionCandidates(
-        GetHadIdxsFromMichels(endpoint_michels, vtx_michels));
+    if (is_michel_cut)
+      universe.SetPionCandidates(
+          GetHadIdxsFromMichels(endpoint_michels, vtx_michels));
 
-    bool passes_this_cut = false;
-    std::tie(passes_this_cut, endpoint_michels, vtx_michels) = PassesCut(
-        universe, c, is_mc, signal_definition, endpoint_michels, vtx_michels);
+    const bool passes_this_cut =
+        pipeline.Apply(i, universe, is_mc, signal_definition, endpoint_michels,
+                       vtx_michels);
     passes_all_cuts_except_w = passes_all_cuts_except_w && passes_this_cut;
-//    if (passes_this_cut) break; 
-    //   if (!passes_this_cut) std::cout << "Fail this cut " << c << "\n";
   }
+  pipeline.EndEvent();
 
   // Convert michels --> tracks
   // (we're done manipulating the michels, so we can do this now.)
@@ -146,12 +248,23 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
           const SignalDefinition signal_definition,
           const endpoint::MichelMap& em,
           const LowRecoilPion::MichelEvent<CVUniverse>& vm) {
-  bool pass = false;
   endpoint::MichelMap endpoint_michels = em;
   LowRecoilPion::MichelEvent<CVUniverse> vtx_michels = vm;
+  const bool pass = ApplyCut(univ, cut, is_mc, signal_definition,
+                             endpoint_michels, vtx_michels);
+  return {pass, endpoint_michels, vtx_michels};
+}
+
+// Pass Single, Given Cut v3
+// Same as PassesCut, but updates the michel containers in place.
+bool ApplyCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
+              const SignalDefinition& signal_definition,
+              endpoint::MichelMap& endpoint_michels,
+              LowRecoilPion::MichelEvent<CVUniverse>& vtx_michels) {
+  bool pass = false;
   const bool useOVMichels = false;
 
-  if (IsPrecut(cut) && !is_mc) return {true, endpoint_michels, vtx_michels};
+  if (IsPrecut(cut) && !is_mc) return true;
 
   switch (cut) {
     case kNoCuts:
@@ -232,10 +345,9 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
 
     // If a michel's pion fails the LLR cut, remove it from the michels
     case kLLR: {
-      ContainerEraser::erase_if(endpoint_michels,
-                                [&univ](std::pair<int, endpoint::Michel> mm) {
-                                  return !LLRCut(univ, mm.second.had_idx);
-                                });
+      endpoint_michels.EraseIf([&univ](const endpoint::Michel& m) {
+        return !PassesHadronCut(univ, hadron_quality::kLLR, m.had_idx);
+      });
       pass = endpoint_michels.size() > 0;  // || vtx_michels.m_idx != -1;
       break;
     }
@@ -243,10 +355,9 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
     // modify michels
     // If a michel's pion fails the node cut, remove it from the michels
     case kNode: {
-      ContainerEraser::erase_if(endpoint_michels,
-                                [&univ](std::pair<int, endpoint::Michel> mm) {
-                                  return !NodeCut(univ, mm.second.had_idx);
-                                });
+      endpoint_michels.EraseIf([&univ](const endpoint::Michel& m) {
+        return !PassesHadronCut(univ, hadron_quality::kNode, m.had_idx);
+      });
       pass = endpoint_michels.size() > 0;  // || vtx_michels.m_idx != -1;
       break;
     }
@@ -254,10 +365,10 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
     // modify michels
     // If a michel's pion fails track quality, remove it from the michels
     case kTrackQuality: {
-      ContainerEraser::erase_if(
-          endpoint_michels, [&univ](std::pair<int, endpoint::Michel> mm) {
-            return !HadronQualityCuts(univ, mm.second.had_idx);
-          });
+      endpoint_michels.EraseIf([&univ](const endpoint::Michel& m) {
+        return !PassesHadronCut(univ, hadron_quality::kTrackQuality,
+                                m.had_idx);
+      });
       pass = endpoint_michels.size() > 0;  // || vtx_michels.m_idx != -1;
       break;
     }
@@ -310,10 +421,10 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
       break;
 
     case kGoodMomentum:{
-      ContainerEraser::erase_if(endpoint_michels,
-                                [&univ](std::pair<int, endpoint::Michel> mm) {
-                                  return !hasGoodMomentum(univ, mm.second.had_idx);
-                                });
+      endpoint_michels.EraseIf([&univ](const endpoint::Michel& m) {
+        return !PassesHadronCut(univ, hadron_quality::kGoodMomentum,
+                                m.had_idx);
+      });
       pass = endpoint_michels.size() > 0; // || vtx_michels.m_idx != -1;
       break;
     }
@@ -333,7 +444,7 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
       pass = false;
   };
 
-  return {pass, endpoint_michels, vtx_michels};
+  return pass;
 }
 
 //==============================================================================
@@ -392,7 +503,7 @@ std::vector<int> GetQualityPionCandidateIndices(const CVUniverse& univ) {
   std::vector<int> pion_candidate_indices;
   int n_hadrons = univ.GetInt("MasterAnaDev_hadron_number");
   for (int i_hadron = 0; i_hadron != n_hadrons; ++i_hadron)
-    if (HadronQualityCuts(univ, i_hadron))
+    if (PassesHadronCut(univ, hadron_quality::kTrackQuality, i_hadron))
       pion_candidate_indices.push_back(i_hadron);
   return pion_candidate_indices;
 }
@@ -405,6 +516,101 @@ bool HadronQualityCuts(const CVUniverse& univ, const RecoPionIdx pidx) {
          univ.GetVecElem("MasterAnaDev_hadron_isTracker", pidx) == 1;
 };
 
+namespace {
+bool EvaluateHadronCut(const CVUniverse& univ,
+                       const hadron_quality::EHadronCut cut,
+                       const RecoPionIdx pidx) {
+  switch (cut) {
+    case hadron_quality::kTrackQuality:
+      return HadronQualityCuts(univ, pidx);
+    case hadron_quality::kLLR:
+      return LLRCut(univ, pidx);
+    case hadron_quality::kNode:
+      return NodeCut(univ, pidx);
+    case hadron_quality::kGoodMomentum:
+      return hasGoodMomentum(univ, pidx);
+    default:
+      std::cerr << "EvaluateHadronCut: unknown cut " << cut << "\n";
+      std::exit(1);
+  }
+}
+}  // namespace
+
+bool PassesHadronCut(const CVUniverse& univ,
+                     const hadron_quality::EHadronCut cut,
+                     const RecoPionIdx pidx) {
+  const hadron_quality::HadronQualityCache* cache = univ.GetHadronQuality();
+  if (cache && cache->Has(cut, pidx) &&
+      !(univ.GetShiftedHadronCuts() & hadron_quality::Bit(cut)))
+    return cache->Passes(cut, pidx);
+  return EvaluateHadronCut(univ, cut, pidx);
+}
+
+void FillHadronQualityCache(const CVUniverse& cv,
+                            hadron_quality::HadronQualityCache& cache,
+                            const std::vector<ECuts>& cuts) {
+  cache.Clear();
+  // The hadron cuts that the cut list makes
+  std::vector<hadron_quality::EHadronCut> hadron_cuts;
+  for (const ECuts cut : cuts) {
+    switch (cut) {
+      case kTrackQuality:
+        hadron_cuts.push_back(hadron_quality::kTrackQuality);
+        break;
+      case kLLR:
+        hadron_cuts.push_back(hadron_quality::kLLR);
+        break;
+      case kNode:
+        hadron_cuts.push_back(hadron_quality::kNode);
+        break;
+      case kGoodMomentum:
+        hadron_cuts.push_back(hadron_quality::kGoodMomentum);
+        break;
+      default:
+        break;
+    }
+  }
+  if (hadron_cuts.empty()) return;
+  // They're only asked of michel-matched hadrons
+  for (const auto& michel : endpoint::GetQualityMichels(cv))
+    for (const auto cut : hadron_cuts)
+      cache.Set(michel.second.had_idx, cut,
+                EvaluateHadronCut(cv, cut, michel.second.had_idx));
+}
+
+bool RecoTracklessMichels(
+    CVUniverse& cv, const bool onlytracked,
+    LowRecoilPion::MichelEvent<CVUniverse>& trackless_michels) {
+  timing::ScopedTimer michel_timer(timing::kMichelReco);
+  bool good_trackless_michels;
+  LowRecoilPion::Cluster d;
+  LowRecoilPion::Cluster c(cv, 0);
+  LowRecoilPion::Michel<CVUniverse> m(cv, 0);
+  if (onlytracked) {
+    good_trackless_michels = false;
+  } else {
+    good_trackless_michels =
+        LowRecoilPion::hasMichel<CVUniverse,
+                                 LowRecoilPion::MichelEvent<CVUniverse>>::
+            hasMichelCut(cv, trackless_michels);
+    // good_trackless_michels = BestMichelDistance2DCut(*universe,
+    // trackless_michels);
+    good_trackless_michels =
+        good_trackless_michels &&
+        LowRecoilPion::BestMichelDistance2D<
+            CVUniverse, LowRecoilPion::MichelEvent<CVUniverse>>::
+            BestMichelDistance2DCut(cv, trackless_michels);
+    // good_trackless_michels = MichelRangeCut(*universe,
+    // trackless_michels);
+    good_trackless_michels =
+        good_trackless_michels &&
+        LowRecoilPion::GetClosestMichel<
+            CVUniverse, LowRecoilPion::MichelEvent<CVUniverse>>::
+            GetClosestMichelCut(cv, trackless_michels);
+  }
+  return good_trackless_michels;
+}
+
 //============================
 /// Aaron's Cuts
 //============================
@@ -16,6 +16,7 @@
 #include "CVUniverse.h"
 #include "Constants.h"  // enum ECuts, CCNuPionIncConsts, PassesCutsInfo
 #include "CutUtils.h"   // kCutsVector
+#include "HadronQuality.h"  // hadron_quality::EHadronCut, HadronQualityCache
 #include "Michel.h"     // endpoint::Michel, endpoint::MichelMap
 #include "PlotUtils/LowRecoilPionCuts.h"
 #include "PlotUtils/LowRecoilPionFunctions.h"
@@ -26,12 +27,14 @@
 //      * PassesCutsInfo(passes, is_sideband, all_except_w, pion_idxs) =
 //      PassesCuts()
 //      * tuple(passes, endpoint_michels, vtx_michels) = PassesCut(cut)
+//      * passes = ApplyCut(cut, endpoint_michels, vtx_michels)
 //      * PassedCuts <-- just an event counter
 //==============================================================================
 // NEW return passes_all_cuts, is_w_sideband, and pion_candidate_idxs
 // PassesCuts v3 (latest and greatest))
 PassesCutsInfo PassesCuts(CVUniverse&, const bool is_mc, const SignalDefinition,
-                          const std::vector<ECuts> cuts = kCutsVector);
+                          const std::vector<ECuts> cuts = kCutsVector,
+                          const bool need_pion_candidates = true);
 
 // Event Counter
 EventCount PassedCuts(const CVUniverse&, std::vector<int>& pion_candidate_idxs,
@@ -45,6 +48,11 @@ PassesCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
           const SignalDefinition, const endpoint::MichelMap&,
           const LowRecoilPion::MichelEvent<CVUniverse>&);
 
+// Passes Single, Given Cut, updating the michel containers in place
+bool ApplyCut(const CVUniverse& univ, const ECuts cut, const bool is_mc,
+              const SignalDefinition&, endpoint::MichelMap&,
+              LowRecoilPion::MichelEvent<CVUniverse>&);
+
 //==============================================================================
 // Cuts Definitions
 //==============================================================================
@@ -82,6 +90,24 @@ bool HadronQualityCuts(const CVUniverse&, const RecoPionIdx pion_candidate_idx);
 bool LLRCut(const CVUniverse&, const RecoPionIdx pion_candidate_idx);
 bool NodeCut(const CVUniverse&, const RecoPionIdx pion_candidate_idx);
 
+// One of the above (or hasGoodMomentum), from the universe's
+// HadronQualityCache when it has one. See HadronQuality.h.
+bool PassesHadronCut(const CVUniverse&, const hadron_quality::EHadronCut,
+                     const RecoPionIdx pion_candidate_idx);
+
+// Evaluate the pion candidate track cuts that cuts makes, for the
+// michel-matched hadrons of cv's entry
+void FillHadronQualityCache(const CVUniverse& cv,
+                            hadron_quality::HadronQualityCache&,
+                            const std::vector<ECuts>& cuts = kCutsVector);
+
+// Reconstruct the CV's trackless (vertex) michels into trackless_michels.
+// Returns whether they pass the michel cuts (never, if onlytracked). Every
+// universe uses the CV's.
+bool RecoTracklessMichels(
+    CVUniverse& cv, const bool onlytracked,
+    LowRecoilPion::MichelEvent<CVUniverse>& trackless_michels);
+
 //==============================================================================
 // Helper
 //==============================================================================
@@ -89,8 +115,8 @@ bool NodeCut(const CVUniverse&, const RecoPionIdx pion_candidate_idx);
 std::vector<int> GetQualityPionCandidateIndices(const CVUniverse&);
 
 std::vector<int> GetHadIdxsFromMichels(
-    const endpoint::MichelMap endpoint_michels,
-    const LowRecoilPion::MichelEvent<CVUniverse> vtx_michels =
+    const endpoint::MichelMap& endpoint_michels,
+    const LowRecoilPion::MichelEvent<CVUniverse>& vtx_michels =
         LowRecoilPion::MichelEvent<CVUniverse>());
 
 // bool AtLeastOnePionCut(const CVUniverse& univ) {
@@ -0,0 +1,91 @@
+#ifndef FactorizedWeight_h
+#define FactorizedWeight_h
+
+//==============================================================================
+// Event weights for vertical-only universes, from the CV's weight factors.
+//
+// Most vertical universes shift exactly one factor of CVUniverse::GetWeight
+// (a GENIE knob, a flux universe, ...), and share everything else with the
+// CV. Each such universe declares its factor, GetShiftedWeightFactor. So
+// compute the CV's factors once per entry, and for each universe only
+// recompute its own factor. The product is taken in the same order as
+// GetWeight, so the weight is bit-for-bit the same.
+//
+// Bootstrap universes (Bootstrap.h) are the CV's weight times their Poisson
+// draw, with the event key also computed once per entry.
+//
+// Universes that don't declare a factor get the full GetWeight.
+// tests/testFactorizedWeight.C checks every universe over a whole sample.
+//==============================================================================
+#include <cassert>
+#include <unordered_map>
+
+#include "Bootstrap.h"
+#include "CVUniverse.h"
+#include "Constants.h"  // typedef UniverseMap
+
+namespace weights {
+class FactorizedWeight {
+ public:
+  static const int kFullWeight = -1;  // Owner::factor of undeclared universes
+  static const int kBootstrap = -2;   // and of bootstrap universes
+
+  explicit FactorizedWeight(const UniverseMap& error_bands)
+      : m_has_bootstrap(false), m_cv_weight(0.), m_bootstrap_key(0) {
+    for (const auto& band : error_bands) {
+      for (const CVUniverse* universe : band.second) {
+        if (auto bootstrap_universe =
+                dynamic_cast<const bootstrap::BootstrapUniverse*>(universe)) {
+          m_has_bootstrap = true;
+          m_owners[universe] = {kBootstrap, bootstrap_universe->Index()};
+          continue;
+        }
+        const int factor = universe->GetShiftedWeightFactor();
+        assert(factor >= kFullWeight &&
+               factor < CVUniverse::kNWeightFactors &&
+               "FactorizedWeight: no such weight factor");
+        m_owners[universe] = {factor, -1};
+      }
+    }
+  }
+
+  // Call once per entry, after the CV's signal and pion candidates are set.
+  void SetCV(const CVUniverse& cv) {
+    m_cv_factors = cv.GetWeightFactors();
+    if (m_has_bootstrap) {
+      m_cv_weight = CVUniverse::MultiplyWeightFactors(m_cv_factors);
+      m_bootstrap_key = bootstrap::GetEventKey(cv);
+    }
+  }
+
+  // Universe must have the CV's entry, signal, and pion candidates.
+  double GetWeight(const CVUniverse& universe) const {
+    auto it = m_owners.find(&universe);
+    if (it == m_owners.end() || it->second.factor == kFullWeight)
+      return universe.GetWeight();
+
+    const Owner& owner = it->second;
+    if (owner.factor == kBootstrap)
+      return m_cv_weight *
+             bootstrap::GetPoissonWeight(m_bootstrap_key, owner.bootstrap);
+
+    CVUniverse::WeightFactors factors = m_cv_factors;
+    const auto factor = static_cast<CVUniverse::EWeightFactor>(owner.factor);
+    factors[factor] = universe.GetWeightFactor(factor);
+    return CVUniverse::MultiplyWeightFactors(factors);
+  }
+
+ private:
+  struct Owner {
+    int factor;
+    int bootstrap;  // index of a bootstrap universe
+  };
+  std::unordered_map<const CVUniverse*, Owner> m_owners;
+  CVUniverse::WeightFactors m_cv_factors;
+  bool m_has_bootstrap;
+  double m_cv_weight;
+  uint64_t m_bootstrap_key;
+};
+}  // namespace weights
+
+#endif  // FactorizedWeight_h
@@ -0,0 +1,59 @@
+#ifndef HadronQuality_h
+#define HadronQuality_h
+
+//==============================================================================
+// Per-entry results of the cuts on pion candidate tracks.
+//
+// HadronQualityCuts, LLRCut, NodeCut, and hasGoodMomentum are asked of every
+// michel-matched hadron, in every universe that makes cuts. What they read
+// doesn't depend on the universe, so the CV evaluates them once per entry
+// (FillHadronQualityCache, Cuts.h) and hands the results to its universes
+// with CVUniverse::SetHadronQuality. A universe whose shift does change one of
+// them lists it in CVUniverse::GetShiftedHadronCuts, and evaluates only that
+// one itself.
+//
+// Only the cuts of the active cut list are cached, and only for the CV's
+// michel-matched hadrons below kMaxHadrons. Anything else is evaluated when
+// it's asked for.
+//==============================================================================
+
+namespace hadron_quality {
+enum EHadronCut { kTrackQuality, kLLR, kNode, kGoodMomentum, kNHadronCuts };
+
+constexpr unsigned int Bit(const EHadronCut c) { return 1u << c; }
+
+class HadronQualityCache {
+ public:
+  static const int kMaxHadrons = 32;
+
+  HadronQualityCache() : m_evaluated(), m_passed() {}
+
+  void Clear() {
+    for (int i = 0; i < kMaxHadrons; ++i) m_evaluated[i] = m_passed[i] = 0;
+  }
+
+  // Record hadron's result for cut. Ignored past kMaxHadrons.
+  void Set(const int hadron, const EHadronCut cut, const bool passes) {
+    if (hadron < 0 || hadron >= kMaxHadrons) return;
+    m_evaluated[hadron] |= Bit(cut);
+    if (passes) m_passed[hadron] |= Bit(cut);
+  }
+
+  bool Has(const EHadronCut cut, const int hadron) const {
+    return 0 <= hadron && hadron < kMaxHadrons &&
+           (m_evaluated[hadron] & Bit(cut));
+  }
+
+  // Only for cuts and hadrons that Has
+  bool Passes(const EHadronCut cut, const int hadron) const {
+    return m_passed[hadron] & Bit(cut);
+  }
+
+ private:
+  // masks of Bit(EHadronCut), by hadron
+  unsigned char m_evaluated[kMaxHadrons];
+  unsigned char m_passed[kMaxHadrons];
+};
+}  // namespace hadron_quality
+
+#endif  // HadronQuality_h
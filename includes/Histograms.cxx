@@ -4,6 +4,245 @@
 #include "Histograms.h"
 
 #include <algorithm>
+#include <cassert>
+
+#include "TH2.h"
+
+//==============================================================================
+// Memory estimates
+//==============================================================================
+namespace {
+// ROOT's per-hist overhead (object, axes, name, title), roughly
+const double kTH1OverheadBytes = 1000.;
+
+// Bytes of a TH1 and its sum of squared weights
+double HistBytes(const TH1* h) {
+  if (!h) return 0.;
+  return kTH1OverheadBytes +
+         h->GetNcells() * sizeof(double) * (h->GetSumw2N() ? 2 : 1);
+}
+
+// Bytes of an MnvH1D or MnvH2D and its error bands' hists
+template <typename MH>
+double MnvHistBytes(MH* h) {
+  if (!h) return 0.;
+  double n_hists = 1.;
+  for (const auto& name : h->GetVertErrorBandNames())
+    n_hists += 1. + h->GetVertErrorBand(name)->GetNHists();
+  for (const auto& name : h->GetLatErrorBandNames())
+    n_hists += 1. + h->GetLatErrorBand(name)->GetNHists();
+  return n_hists * HistBytes(h);
+}
+
+template <typename T>
+double StackBytes(const StackedHistogram<T>& stack) {
+  double bytes = 0.;
+  for (const auto& i : stack.m_hist_map) bytes += MnvHistBytes(i.second);
+  return bytes;
+}
+
+template <typename T>
+void DeleteStack(StackedHistogram<T>& stack) {
+  for (const auto& i : stack.m_hist_map) delete i.second;
+  stack = StackedHistogram<T>();
+}
+}  // namespace
+
+//==============================================================================
+// Sumw2
+//==============================================================================
+sumw2::Config& sumw2::GetConfig() {
+  static Config config{true, {}};
+  return config;
+}
+
+void sumw2::KeepAll() {
+  GetConfig().keep_all = true;
+  GetConfig().bands.clear();
+}
+
+void sumw2::KeepOnly(const std::set<std::string>& bands) {
+  GetConfig().keep_all = false;
+  GetConfig().bands = bands;
+}
+
+bool sumw2::IsKept(const std::string& band) {
+  const Config& config = GetConfig();
+  return config.keep_all || band == "cv" || config.bands.count(band);
+}
+
+template <typename HW>
+void sumw2::DropUniverseSumw2(HW& hw, const UniverseMap& univs) {
+  if (GetConfig().keep_all || !hw.hist) return;
+  for (const auto& band : univs) {
+    if (IsKept(band.first)) continue;
+    for (CVUniverse* univ : band.second) {
+      TH1* h = hw.univHist(univ);
+      h->Sumw2(kFALSE);
+      // Or else TH1::Fill turns it back on for the first weight != 1
+      h->SetBit(TH1::kIsNotW);
+    }
+  }
+}
+
+void FillBinCenter(TH1* h, const int bin, const double w) {
+  int bin_x = 0, bin_y = 0, bin_z = 0;
+  h->GetBinXYZ(bin, bin_x, bin_y, bin_z);
+  const double x = h->GetXaxis()->GetBinCenter(bin_x);
+  if (h->GetDimension() == 1)
+    h->Fill(x, w);
+  else
+    static_cast<TH2*>(h)->Fill(x, h->GetYaxis()->GetBinCenter(bin_y), w);
+}
+
+//==============================================================================
+// FlatHW
+//==============================================================================
+FlatHW::FlatHW() : CVHW(), m_is_flat(false), m_n_bins(0), m_clear_bands(true) {}
+
+FlatHW::FlatHW(const CVHW& hw)
+    : CVHW(hw), m_is_flat(false), m_n_bins(0), m_clear_bands(true) {}
+
+FlatHW::FlatHW(MH1D* base, const UniverseMap& univs, const bool clear_bands,
+               const bool flat_storage)
+    : CVHW(), m_is_flat(flat_storage), m_n_bins(0), m_clear_bands(clear_bands) {
+  if (!m_is_flat) {
+    CVHW::operator=(CVHW(base, univs, clear_bands));
+    sumw2::DropUniverseSumw2(*this, univs);
+    return;
+  }
+  m_name = base->GetName();
+  m_title = base->GetTitle();
+  m_n_bins = base->GetNbinsX();
+  for (int i = 1; i <= m_n_bins + 1; ++i)
+    m_edges.push_back(base->GetXaxis()->GetBinLowEdge(i));
+  m_univs = univs;
+
+  // One row per universe, in band order, so that FlatHWs made from the same
+  // error band layout line up row-for-row
+  int n_rows = 0, n_sumw2_rows = 0;
+  for (const auto& band : m_univs) {
+    const bool keep_sumw2 = sumw2::IsKept(band.first);
+    for (const CVUniverse* univ : band.second) {
+      m_rows[univ] = n_rows++;
+      m_sumw2_rows.push_back(keep_sumw2 ? n_sumw2_rows++ : -1);
+    }
+  }
+  m_sumw.assign(n_rows * (m_n_bins + 2), 0.);
+  m_sumw2.assign(n_sumw2_rows * (m_n_bins + 2), 0.);
+  m_entries.assign(n_rows, 0.);
+}
+
+int FlatHW::GetRow(const CVUniverse* univ) const {
+  auto it = m_rows.find(univ);
+  if (it == m_rows.end()) {
+    std::cerr << "FlatHW " << m_name << ": universe " << univ->ShortName()
+              << " has no row\n";
+    std::exit(1);
+  }
+  return it->second;
+}
+
+// Same as TAxis::FindBin: 0 below the first edge, nbins+1 at or above the last
+int FlatHW::FindBin(const double value) const {
+  if (!m_is_flat) return hist->FindBin(value);
+  if (value < m_edges.front()) return 0;
+  if (!(value < m_edges.back())) return m_n_bins + 1;
+  return std::upper_bound(m_edges.begin(), m_edges.end(), value) -
+         m_edges.begin();
+}
+
+void FlatHW::FillUniverse(const CVUniverse& univ, const double value,
+                          const double weight) {
+  if (!m_is_flat) {
+    CVHW::FillUniverse(univ, value, weight);
+    return;
+  }
+  const int row = GetRow(&univ);
+  const int bin = FindBin(value);
+  m_sumw[Cell(row, bin)] += weight;
+  if (m_sumw2_rows[row] >= 0)
+    m_sumw2[Cell(m_sumw2_rows[row], bin)] += weight * weight;
+  m_entries[row] += 1.;
+}
+
+void FlatHW::AddToUniverseBin(const CVUniverse* univ, const int bin,
+                              const double w) {
+  if (!m_is_flat) {
+    FillBinCenter(univHist(univ), bin, w);
+    return;
+  }
+  const int row = GetRow(univ);
+  m_sumw[Cell(row, bin)] += w;
+  if (m_sumw2_rows[row] >= 0) m_sumw2[Cell(m_sumw2_rows[row], bin)] += w * w;
+  m_entries[row] += 1.;
+}
+
+void FlatHW::Add(const FlatHW& hw) {
+  if (m_is_flat != hw.m_is_flat) {
+    std::cerr << "FlatHW::Add: can't add flat and unflat " << m_name << "\n";
+    std::exit(1);
+  }
+  if (!m_is_flat) {
+    if (hist && hw.hist) hist->Add(hw.hist);
+    return;
+  }
+  if (m_sumw.size() != hw.m_sumw.size() ||
+      m_sumw2.size() != hw.m_sumw2.size()) {
+    std::cerr << "FlatHW::Add: " << m_name
+              << " has a different universe or Sumw2 layout\n";
+    std::exit(1);
+  }
+  for (size_t i = 0; i < m_sumw.size(); ++i) m_sumw[i] += hw.m_sumw[i];
+  for (size_t i = 0; i < m_sumw2.size(); ++i) m_sumw2[i] += hw.m_sumw2[i];
+  for (size_t i = 0; i < m_entries.size(); ++i) m_entries[i] += hw.m_entries[i];
+}
+
+// Build the MnvH1D and error bands, copy the sums in, and drop the arrays
+void FlatHW::Materialize() {
+  MH1D* base = new MH1D(m_name.c_str(), m_title.c_str(), m_n_bins,
+                        m_edges.data());
+  CVHW::operator=(CVHW(base, m_univs, m_clear_bands));
+  delete base;
+  sumw2::DropUniverseSumw2(*this, m_univs);
+
+  for (const auto& band : m_univs) {
+    for (CVUniverse* univ : band.second) {
+      const int row = GetRow(univ);
+      const int sumw2_row = m_sumw2_rows[row];
+      TH1* h = univHist(univ);
+      for (int bin = 0; bin <= m_n_bins + 1; ++bin) {
+        h->SetBinContent(bin, m_sumw[Cell(row, bin)]);
+        if (h->GetSumw2N() && sumw2_row >= 0)
+          h->GetSumw2()->fArray[bin] = m_sumw2[Cell(sumw2_row, bin)];
+      }
+      h->ResetStats();
+      h->SetEntries(m_entries[row]);
+    }
+  }
+
+  m_is_flat = false;
+  m_rows.clear();
+  std::vector<double>().swap(m_sumw);
+  std::vector<double>().swap(m_sumw2);
+  std::vector<int>().swap(m_sumw2_rows);
+  std::vector<double>().swap(m_entries);
+}
+
+double FlatHW::GetMemoryBytes() const {
+  if (!m_is_flat) return MnvHistBytes(hist);
+  return (m_sumw.size() + m_sumw2.size() + m_entries.size()) * sizeof(double) +
+         m_sumw2_rows.size() * sizeof(int) + m_rows.size() * 4 * sizeof(void*);
+}
+
+void FlatHW::SyncCVHistos() {
+  if (m_is_flat) Materialize();
+  CVHW::SyncCVHistos();
+}
+
+//==============================================================================
+// Histograms
+//==============================================================================
 
 // CTOR -- default
 Histograms::Histograms()
@@ -21,6 +260,9 @@ Histograms::Histograms()
       m_effnum(),
       m_migration(),
       m_selection_data(),
+      m_selection_data_tracked(),
+      m_selection_data_untracked(),
+      m_selection_data_mixed(),
       m_selection_mc(),
       m_selection_mc_tracked(),
       m_selection_mc_untracked(),
@@ -284,29 +526,171 @@ void Histograms::LoadDataHistsFromFile(TFile& fin) {
       Form("wsidebandfit_data_%s", m_label.c_str()));
 }
 
+// Error band universes are summed along with the CV.
+void Histograms::AddMCRecoHists(const Histograms& h) {
+  auto add_hw = [](FlatHW& to, const FlatHW& from) { to.Add(from); };
+  add_hw(m_selection_mc, h.m_selection_mc);
+  add_hw(m_selection_mc_tracked, h.m_selection_mc_tracked);
+  add_hw(m_selection_mc_untracked, h.m_selection_mc_untracked);
+  add_hw(m_selection_mc_mixed, h.m_selection_mc_mixed);
+  add_hw(m_selection_mc_no_tpi_weight, h.m_selection_mc_no_tpi_weight);
+  add_hw(m_selection_mc_tracked_no_tpi_weight,
+         h.m_selection_mc_tracked_no_tpi_weight);
+  add_hw(m_selection_mc_untracked_no_tpi_weight,
+         h.m_selection_mc_untracked_no_tpi_weight);
+  add_hw(m_selection_mc_mixed_no_tpi_weight,
+         h.m_selection_mc_mixed_no_tpi_weight);
+  add_hw(m_bg, h.m_bg);
+  add_hw(m_bg_loW, h.m_bg_loW);
+  add_hw(m_bg_midW, h.m_bg_midW);
+  add_hw(m_bg_hiW, h.m_bg_hiW);
+  add_hw(m_effnum, h.m_effnum);
+  add_hw(m_wsidebandfit_sig, h.m_wsidebandfit_sig);
+  add_hw(m_wsidebandfit_loW, h.m_wsidebandfit_loW);
+  add_hw(m_wsidebandfit_midW, h.m_wsidebandfit_midW);
+  add_hw(m_wsidebandfit_hiW, h.m_wsidebandfit_hiW);
+
+  if (m_migration.hist && h.m_migration.hist)
+    m_migration.hist->Add(h.m_migration.hist);
+
+  if (m_noWcut && h.m_noWcut) m_noWcut->Add(h.m_noWcut);
+
+  m_stacked_channel.Add(h.m_stacked_channel);
+  m_stacked_coherent.Add(h.m_stacked_coherent);
+  m_stacked_fspart.Add(h.m_stacked_fspart);
+  m_stacked_hadron.Add(h.m_stacked_hadron);
+  m_stacked_mesonbg.Add(h.m_stacked_mesonbg);
+  m_stacked_npi0.Add(h.m_stacked_npi0);
+  m_stacked_npi.Add(h.m_stacked_npi);
+  m_stacked_npip.Add(h.m_stacked_npip);
+  m_stacked_sigbg.Add(h.m_stacked_sigbg);
+  m_stacked_w.Add(h.m_stacked_w);
+  m_stacked_wbg.Add(h.m_stacked_wbg);
+  m_stacked_wsideband.Add(h.m_stacked_wsideband);
+  m_stacked_pionreco.Add(h.m_stacked_pionreco);
+}
+
+void Histograms::AddMCTruthHists(const Histograms& h) {
+  m_effden.Add(h.m_effden);
+}
+
+void Histograms::AddDataHists(const Histograms& h) {
+  auto add = [](MH1D* to, const MH1D* from) {
+    if (to && from) to->Add(from);
+  };
+  add(m_selection_data, h.m_selection_data);
+  add(m_selection_data_tracked, h.m_selection_data_tracked);
+  add(m_selection_data_untracked, h.m_selection_data_untracked);
+  add(m_selection_data_mixed, h.m_selection_data_mixed);
+  add(m_wsidebandfit_data, h.m_wsidebandfit_data);
+  add(m_wsideband_data, h.m_wsideband_data);
+  add(m_noWcut_data, h.m_noWcut_data);
+}
+
+void Histograms::DeleteHists() {
+  for (FlatHW* hw :
+       {&m_bg, &m_bg_hiW, &m_bg_loW, &m_bg_midW, &m_effden, &m_effnum,
+        &m_selection_mc, &m_selection_mc_tracked, &m_selection_mc_untracked,
+        &m_selection_mc_mixed, &m_selection_mc_no_tpi_weight,
+        &m_selection_mc_tracked_no_tpi_weight,
+        &m_selection_mc_untracked_no_tpi_weight,
+        &m_selection_mc_mixed_no_tpi_weight, &m_wsidebandfit_hiW,
+        &m_wsidebandfit_loW, &m_wsidebandfit_midW, &m_wsidebandfit_sig}) {
+    delete hw->hist;  // and with it, the universe hists
+    *hw = FlatHW();
+  }
+
+  delete m_migration.hist;
+  m_migration = CVH2DW();
+
+  for (MH1D** h :
+       {&m_bg_subbed_data, &m_cross_section, &m_efficiency, &m_selection_data,
+        &m_selection_data_tracked, &m_selection_data_untracked,
+        &m_selection_data_mixed, &m_tuned_bg, &m_unfolded, &m_wsideband_data,
+        &m_noWcut_data, &m_wsidebandfit_data, &m_noWcut}) {
+    delete *h;
+    *h = nullptr;
+  }
+
+  DeleteStack(m_stacked_channel);
+  DeleteStack(m_stacked_coherent);
+  DeleteStack(m_stacked_fspart);
+  DeleteStack(m_stacked_hadron);
+  DeleteStack(m_stacked_mesonbg);
+  DeleteStack(m_stacked_npi0);
+  DeleteStack(m_stacked_npi);
+  DeleteStack(m_stacked_npip);
+  DeleteStack(m_stacked_sigbg);
+  DeleteStack(m_stacked_w);
+  DeleteStack(m_stacked_wbg);
+  DeleteStack(m_stacked_wsideband);
+  DeleteStack(m_stacked_pionreco);
+}
+
+double Histograms::GetMemoryEstimateMB() const {
+  double bytes = 0.;
+  for (const FlatHW* hw :
+       {&m_bg, &m_bg_hiW, &m_bg_loW, &m_bg_midW, &m_effden, &m_effnum,
+        &m_selection_mc, &m_selection_mc_tracked, &m_selection_mc_untracked,
+        &m_selection_mc_mixed, &m_selection_mc_no_tpi_weight,
+        &m_selection_mc_tracked_no_tpi_weight,
+        &m_selection_mc_untracked_no_tpi_weight,
+        &m_selection_mc_mixed_no_tpi_weight, &m_wsidebandfit_hiW,
+        &m_wsidebandfit_loW, &m_wsidebandfit_midW, &m_wsidebandfit_sig})
+    bytes += hw->GetMemoryBytes();
+
+  bytes += MnvHistBytes(m_migration.hist);
+
+  for (MH1D* h :
+       {m_bg_subbed_data, m_cross_section, m_efficiency, m_selection_data,
+        m_selection_data_tracked, m_selection_data_untracked,
+        m_selection_data_mixed, m_tuned_bg, m_unfolded, m_wsideband_data,
+        m_noWcut_data, m_wsidebandfit_data, m_noWcut})
+    bytes += MnvHistBytes(h);
+
+  bytes += StackBytes(m_stacked_channel) + StackBytes(m_stacked_coherent) +
+           StackBytes(m_stacked_fspart) + StackBytes(m_stacked_hadron) +
+           StackBytes(m_stacked_mesonbg) + StackBytes(m_stacked_npi0) +
+           StackBytes(m_stacked_npi) + StackBytes(m_stacked_npip) +
+           StackBytes(m_stacked_sigbg) + StackBytes(m_stacked_w) +
+           StackBytes(m_stacked_wbg) + StackBytes(m_stacked_wsideband) +
+           StackBytes(m_stacked_pionreco);
+  return bytes / (1024. * 1024.);
+}
+
 // Initialize Hists
 template <typename T>
 void Histograms::InitializeAllHists(T systematic_univs,
-                                    T systematic_univs_truth) {
+                                    T systematic_univs_truth,
+                                    const bool flat_storage,
+                                    const int families) {
   // Event Section Analysis
-  InitializeSelectionHists(systematic_univs, systematic_univs_truth);
+  if (families & kSelectionHists)
+    InitializeSelectionHists(systematic_univs, systematic_univs_truth,
+                             flat_storage);
 
   // Migration Matrix
-  InitializeMigrationHist(systematic_univs);
+  if (families & kMigrationHist) InitializeMigrationHist(systematic_univs);
 
   // Sidebands
-  InitializeSidebandHists(systematic_univs);
+  if (families & kSidebandHists)
+    InitializeSidebandHists(systematic_univs, flat_storage);
 
   // Data
-  InitializeDataHists();
+  if (families & kDataHists) InitializeDataHists();
 
   // Event Selection Stacked
-  InitializeStackedHists();
+  if (families & kStackedHists)
+    InitializeStackedHists();
+  else if ((families & kWSidebandStack) &&
+           m_label == sidebands::kFitVarString)
+    InitializeWSidebandStack();
 }
 
 template <typename T>
 void Histograms::InitializeSelectionHists(T systematic_univs,
-                                          T systematic_univs_truth) {
+                                          T systematic_univs_truth,
+                                          const bool flat_storage) {
   const Double_t* bins = m_bins_array.GetArray();
   const char* label = m_label.c_str();
 
@@ -345,27 +729,31 @@ void Histograms::InitializeSelectionHists(T systematic_univs,
   m_noWcut = new MH1D(Form("noWcut_%s", label), label, NBins(), bins);
 
   const bool clear_bands = true;
-  m_selection_mc = CVHW(selection_mc, systematic_univs, clear_bands);
-  m_selection_mc_tracked = CVHW(selection_mc_tracked, systematic_univs,
-                                  clear_bands);
-  m_selection_mc_untracked = CVHW(selection_mc_untracked, systematic_univs,
-                                  clear_bands);
-  m_selection_mc_mixed = CVHW(selection_mc_mixed, systematic_univs,
-                                  clear_bands);
-  m_selection_mc_no_tpi_weight = CVHW(selection_mc_no_tpi_weight,
-                                  systematic_univs, clear_bands);
-  m_selection_mc_tracked_no_tpi_weight = CVHW(selection_mc_tracked_no_tpi_weight,
-                                  systematic_univs, clear_bands);
-  m_selection_mc_untracked_no_tpi_weight = CVHW(selection_mc_untracked_no_tpi_weight,
-                                  systematic_univs, clear_bands);
-  m_selection_mc_mixed_no_tpi_weight = CVHW(selection_mc_mixed_no_tpi_weight,
-                                  systematic_univs, clear_bands);
-  m_bg = CVHW(bg, systematic_univs, clear_bands);
-  m_bg_loW = CVHW(bg_loW, systematic_univs, clear_bands);
-  m_bg_midW = CVHW(bg_midW, systematic_univs, clear_bands);
-  m_bg_hiW = CVHW(bg_hiW, systematic_univs, clear_bands);
-  m_effnum = CVHW(effnum, systematic_univs, clear_bands);
-  m_effden = CVHW(effden, systematic_univs_truth, clear_bands);
+  m_selection_mc =
+      FlatHW(selection_mc, systematic_univs, clear_bands, flat_storage);
+  m_selection_mc_tracked = FlatHW(selection_mc_tracked, systematic_univs,
+                                  clear_bands, flat_storage);
+  m_selection_mc_untracked = FlatHW(selection_mc_untracked, systematic_univs,
+                                    clear_bands, flat_storage);
+  m_selection_mc_mixed = FlatHW(selection_mc_mixed, systematic_univs,
+                                clear_bands, flat_storage);
+  m_selection_mc_no_tpi_weight = FlatHW(
+      selection_mc_no_tpi_weight, systematic_univs, clear_bands, flat_storage);
+  m_selection_mc_tracked_no_tpi_weight =
+      FlatHW(selection_mc_tracked_no_tpi_weight, systematic_univs, clear_bands,
+             flat_storage);
+  m_selection_mc_untracked_no_tpi_weight =
+      FlatHW(selection_mc_untracked_no_tpi_weight, systematic_univs,
+             clear_bands, flat_storage);
+  m_selection_mc_mixed_no_tpi_weight =
+      FlatHW(selection_mc_mixed_no_tpi_weight, systematic_univs, clear_bands,
+             flat_storage);
+  m_bg = FlatHW(bg, systematic_univs, clear_bands, flat_storage);
+  m_bg_loW = FlatHW(bg_loW, systematic_univs, clear_bands, flat_storage);
+  m_bg_midW = FlatHW(bg_midW, systematic_univs, clear_bands, flat_storage);
+  m_bg_hiW = FlatHW(bg_hiW, systematic_univs, clear_bands, flat_storage);
+  m_effnum = FlatHW(effnum, systematic_univs, clear_bands, flat_storage);
+  m_effden = FlatHW(effden, systematic_univs_truth, clear_bands, flat_storage);
   //  m_noWcut = CVHW(noWcut, systematic_univs_truth, clear_bands);
 
   delete selection_mc;
@@ -385,7 +773,8 @@ void Histograms::InitializeSelectionHists(T systematic_univs,
 }
 
 template <typename T>
-void Histograms::InitializeSidebandHists(T systematic_univs) {
+void Histograms::InitializeSidebandHists(T systematic_univs,
+                                         const bool flat_storage) {
   const Double_t* bins = m_bins_array.GetArray();
   const char* label = m_label.c_str();
   MH1D* wsidebandfit_sig =
@@ -401,10 +790,14 @@ void Histograms::InitializeSidebandHists(T systematic_univs) {
       new MH1D(Form("wsidebandfit_hiW_%s", label), label, NBins(), bins);
 
   const bool clear_bands = true;
-  m_wsidebandfit_sig = CVHW(wsidebandfit_sig, systematic_univs, clear_bands);
-  m_wsidebandfit_loW = CVHW(wsidebandfit_loW, systematic_univs, clear_bands);
-  m_wsidebandfit_midW = CVHW(wsidebandfit_midW, systematic_univs, clear_bands);
-  m_wsidebandfit_hiW = CVHW(wsidebandfit_hiW, systematic_univs, clear_bands);
+  m_wsidebandfit_sig =
+      FlatHW(wsidebandfit_sig, systematic_univs, clear_bands, flat_storage);
+  m_wsidebandfit_loW =
+      FlatHW(wsidebandfit_loW, systematic_univs, clear_bands, flat_storage);
+  m_wsidebandfit_midW =
+      FlatHW(wsidebandfit_midW, systematic_univs, clear_bands, flat_storage);
+  m_wsidebandfit_hiW =
+      FlatHW(wsidebandfit_hiW, systematic_univs, clear_bands, flat_storage);
 
   delete wsidebandfit_sig;
   delete wsidebandfit_loW;
@@ -451,6 +844,10 @@ void Histograms::InitializeStackedHists() {
       m_label, m_xlabel, m_bins_array, int(PionRecoType::kNPionRecoTypes), 5);
 
   // Sideband Stacked
+  InitializeWSidebandStack();
+}
+
+void Histograms::InitializeWSidebandStack() {
   m_stacked_wsideband = StackedHistogram<WSidebandType>(
       m_label, m_xlabel, m_bins_array, kNWSidebandTypes,
       sidebands::kWSideband_ColorScheme);
@@ -494,6 +891,7 @@ void Histograms::InitializeMigrationHist(T systematic_univs) {
 
   const bool clear_bands = true;
   m_migration = CVH2DW(migration, systematic_univs, clear_bands);
+  sumw2::DropUniverseSumw2(m_migration, systematic_univs);
 
   delete migration;
 }
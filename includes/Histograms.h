@@ -5,6 +5,10 @@
 #ifndef Histograms_h
 #define Histograms_h
 
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #include "Binning.h"  // MakeUniformBinArray
 #include "CVUniverse.h"
 #include "Constants.h"  // typedefs MH1D, CVHW, CVH2DW
@@ -14,6 +18,112 @@
 #include "TruthMatching.h"
 #include "utilities.h"  // uniq
 
+//==============================================================================
+// Sum of squared weights of systematic universe hists
+//
+// MacroUtil turns on Sumw2 for every hist, but only the contents of the
+// systematic universes are used downstream, not their stat errors. So a
+// macro can keep Sumw2 for just the CV and a chosen few bands. The other
+// bands' universe hists go without, which about halves their memory and size
+// on disk. MnvH1Ds written this way load as before.
+//==============================================================================
+namespace sumw2 {
+struct Config {
+  bool keep_all;
+  std::set<std::string> bands;
+};
+Config& GetConfig();
+
+// Keep Sumw2 for every band (the default), or for the CV and bands only
+void KeepAll();
+void KeepOnly(const std::set<std::string>& bands);
+bool IsKept(const std::string& band);
+
+// Remove Sumw2 from the universe hists of hw's bands that don't keep it
+template <typename HW>
+void DropUniverseSumw2(HW& hw, const UniverseMap& univs);
+}  // namespace sumw2
+
+// Fill h (1D or 2D) with weight w at the center of its global bin. Contents,
+// Sumw2, entries, and the sums of weights update the way they do for a fill
+// of any value in that bin. The sums of weight * value don't: they get the
+// bin center, so a hist filled this way has the mean and RMS of its binned
+// contents, not of the values. (As does a flat FlatHW, whose stats are reset
+// from its bins.)
+void FillBinCenter(TH1* h, const int bin, const double w);
+
+// Families of hists that InitializeAllHists can make. A macro asks for the
+// families it fills, and the rest are never allocated.
+enum EHistFamily {
+  kSelectionHists = 1 << 0,  // selection_mc*, bg*, effnum, effden, noWcut
+  kMigrationHist = 1 << 1,
+  kSidebandHists = 1 << 2,   // wsidebandfit_*
+  kDataHists = 1 << 3,
+  kStackedHists = 1 << 4,    // all StackedHistograms
+  kWSidebandStack = 1 << 5,  // only the W sideband stack, only for wexp_fit
+  kAllHistFamilies = kSelectionHists | kMigrationHist | kSidebandHists |
+                     kDataHists | kStackedHists
+};
+
+//==============================================================================
+// A CVHW that can keep its universes in flat arrays while filling
+//
+// A CVHW holds one TH1D per universe. With flat storage, a FlatHW instead
+// keeps every universe's sum of weights and sum of squared weights in one
+// dense [universe][bin] array, and builds the MnvH1D and its error bands only
+// in SyncCVHistos, right before writing. After that it's an ordinary CVHW.
+// Without flat storage (and when loaded from a file) it's a CVHW all along.
+//
+// It's privately a CVHW: CVHW's FillUniverse and SyncCVHistos aren't virtual,
+// and through a CVHW& they'd skip the flat arrays. Only the hists are public.
+//==============================================================================
+class FlatHW : private CVHW {
+ public:
+  using CVHW::hist;
+  using CVHW::univHist;
+
+  FlatHW();
+  FlatHW(const CVHW& hw);
+  FlatHW(MH1D* base, const UniverseMap& univs, const bool clear_bands,
+         const bool flat_storage);
+
+  bool IsFlat() const { return m_is_flat; }
+
+  // Like CVHW's
+  void FillUniverse(const CVUniverse& univ, const double value,
+                    const double weight = 1.);
+  void SyncCVHistos();
+
+  // Bin of value, same as hist->FindBin
+  int FindBin(const double value) const;
+  // Add w to one bin of univ's hist, like a fill that lands in that bin
+  void AddToUniverseBin(const CVUniverse* univ, const int bin, const double w);
+  // Sum another FlatHW with the same binning and universe layout into this one
+  void Add(const FlatHW& hw);
+  // Approximate heap use of the sums or hists
+  double GetMemoryBytes() const;
+
+ private:
+  int Cell(const int row, const int bin) const {
+    return row * (m_n_bins + 2) + bin;
+  }
+  int GetRow(const CVUniverse* univ) const;
+  void Materialize();
+
+  bool m_is_flat;
+  std::string m_name;
+  std::string m_title;
+  std::vector<double> m_edges;
+  int m_n_bins;
+  UniverseMap m_univs;
+  bool m_clear_bands;
+  std::unordered_map<const CVUniverse*, int> m_rows;
+  std::vector<double> m_sumw;       // [row][bin], under/overflow included
+  std::vector<double> m_sumw2;      // [sumw2 row][bin]
+  std::vector<int> m_sumw2_rows;    // [row] -> sumw2 row, -1 if no Sumw2
+  std::vector<double> m_entries;    // [row]
+};
+
 class Histograms {
  public:
   //==========================================================================
@@ -38,37 +148,37 @@ class Histograms {
   TArrayD m_bins_array;
 
   // Cross Section Pipeline
-  CVHW m_bg;
-  CVHW m_bg_hiW;
-  CVHW m_bg_loW;
-  CVHW m_bg_midW;
+  FlatHW m_bg;
+  FlatHW m_bg_hiW;
+  FlatHW m_bg_loW;
+  FlatHW m_bg_midW;
   MH1D* m_bg_subbed_data;
   MH1D* m_cross_section;
-  CVHW m_effden;
+  FlatHW m_effden;
   MH1D* m_efficiency;
-  CVHW m_effnum;
+  FlatHW m_effnum;
   CVH2DW m_migration;
   MH1D* m_selection_data;
   MH1D* m_selection_data_tracked;
   MH1D* m_selection_data_untracked;
   MH1D* m_selection_data_mixed;
-  CVHW m_selection_mc;
-  CVHW m_selection_mc_tracked;
-  CVHW m_selection_mc_untracked;
-  CVHW m_selection_mc_mixed;
-  CVHW m_selection_mc_no_tpi_weight;
-  CVHW m_selection_mc_tracked_no_tpi_weight;
-  CVHW m_selection_mc_untracked_no_tpi_weight;
-  CVHW m_selection_mc_mixed_no_tpi_weight;
+  FlatHW m_selection_mc;
+  FlatHW m_selection_mc_tracked;
+  FlatHW m_selection_mc_untracked;
+  FlatHW m_selection_mc_mixed;
+  FlatHW m_selection_mc_no_tpi_weight;
+  FlatHW m_selection_mc_tracked_no_tpi_weight;
+  FlatHW m_selection_mc_untracked_no_tpi_weight;
+  FlatHW m_selection_mc_mixed_no_tpi_weight;
   MH1D* m_tuned_bg;
   MH1D* m_unfolded;
   MH1D* m_wsideband_data;
   MH1D* m_noWcut_data;
   MH1D* m_wsidebandfit_data;
-  CVHW m_wsidebandfit_hiW;
-  CVHW m_wsidebandfit_loW;
-  CVHW m_wsidebandfit_midW;
-  CVHW m_wsidebandfit_sig;
+  FlatHW m_wsidebandfit_hiW;
+  FlatHW m_wsidebandfit_loW;
+  FlatHW m_wsidebandfit_midW;
+  FlatHW m_wsidebandfit_sig;
   MH1D* m_noWcut;
 
   // Stacked Histograms
@@ -98,16 +208,27 @@ class Histograms {
   }
 
   // Histogram Initialization
+  // flat_storage: fill the selection and sideband hists through flat
+  // arrays (see FlatHW). Then SyncCVHistos must be called before using them.
+  // families: EHistFamily flags of the hists to make.
   template <typename T>
-  void InitializeAllHists(T systematic_univs, T systematic_univs_truth);
+  void InitializeAllHists(T systematic_univs, T systematic_univs_truth,
+                          const bool flat_storage = false,
+                          const int families = kAllHistFamilies);
   template <typename T>
-  void InitializeSelectionHists(T systematic_univs, T systematic_univs_truth);
+  void InitializeSelectionHists(T systematic_univs, T systematic_univs_truth,
+                                const bool flat_storage = false);
   template <typename T>
-  void InitializeSidebandHists(T systematic_univs);
+  void InitializeSidebandHists(T systematic_univs,
+                               const bool flat_storage = false);
   template <typename T>
   void InitializeMigrationHist(T systematic_univs);
   void InitializeDataHists();
   void InitializeStackedHists();
+  void InitializeWSidebandStack();
+
+  // Approximate heap use of the hists that have been made
+  double GetMemoryEstimateMB() const;
 
   // Stack Map Access
   std::map<WType, MH1D*> GetStackMap(WType type) const;
@@ -132,6 +253,18 @@ class Histograms {
   CVHW LoadHWFromFile(TFile& fin, UniverseMap& error_bands, std::string name);
   CVH2DW LoadH2DWFromFile(TFile& fin, UniverseMap& error_bands,
                           std::string name);
+
+  // Sum another set of MC hists (e.g. a per-thread shard) into these ones:
+  // the hists that the reco loop fills, or the ones the truth loop fills.
+  // Both sets must have the same binning and the loop's error band layout.
+  void AddMCRecoHists(const Histograms& h);
+  void AddMCTruthHists(const Histograms& h);
+  // Same for the data hists that the data loop fills
+  void AddDataHists(const Histograms& h);
+
+  // Delete every hist that's been made (e.g. a shard's, once it's summed),
+  // leaving these Histograms empty
+  void DeleteHists();
 };
 
 // Template member functions need to be available in the header.
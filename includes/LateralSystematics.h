@@ -5,7 +5,7 @@
 
 #include "CVUniverse.h"
 #include "Constants.h"  // CCNuPionIncShifts
-#include "TRandom.h"    // gRandom
+#include "CounterRNG.h"
 #include "utilities.h"  // FixAngle
 
 // TODO shift for michel electron energy
@@ -86,25 +86,34 @@ class DetectorMassShiftCVUniverse : public CVUniverse {
   virtual std::string LatexName() const { return "Detector Mass"; }
 };
 
+// Smears track angles by the angular resolution. The smearing is drawn per
+// event, track, and universe from counter_rng, not gRandom, so that it's the
+// same for every call and safe to evaluate from several threads.
 class TrackAngleShiftCVUniverse : public CVUniverse {
  public:
   TrackAngleShiftCVUniverse(PlotUtils::ChainWrapper* chw, double nsigma)
       : CVUniverse(chw, nsigma) {}
 
   virtual double GetThetamu() const {
-    double shift_val =
-        (CCNuPionIncShifts::muon_angle_res) * (gRandom->Gaus(0.0, 1.0));
+    double shift_val = (CCNuPionIncShifts::muon_angle_res) * GetShift(0);
     return FixAngle(shift_val + CVUniverse::GetThetamu());
   }
 
   virtual double GetThetapi(int hadron) const {
     double shift_val =
-        (CCNuPionIncShifts::pion_angle_res) * (gRandom->Gaus(0.0, 1.0));
+        (CCNuPionIncShifts::pion_angle_res) * GetShift(hadron + 1);
     return FixAngle(shift_val + CVUniverse::GetThetapi(hadron));
   }
 
   virtual std::string ShortName() const { return "TrackAngle"; }
   virtual std::string LatexName() const { return "Track Angle"; }
+
+ private:
+  // Gaus(0, 1) of track 0 (the muon) or hadron + 1, for this universe
+  double GetShift(const int track) const {
+    const uint64_t stream = (uint64_t(GetSigma() > 0.) << 32) | uint64_t(track);
+    return counter_rng::Gaus(counter_rng::GetEventKey(*this), stream);
+  }
 };
 
 class BeamAngleShiftCVUniverse : public CVUniverse {
@@ -3,8 +3,13 @@
 
 #include "MacroUtil.h"
 
+#include <algorithm>  // max
+#include <fstream>
+
 #include "SignalDefinition.h"
 #include "Systematics.h"  // GetSystematicUniversesMap
+#include "TBranch.h"
+#include "TChainElement.h"
 #include "myPlotStyle.h"  // Load my plot style in Init
 
 // CTOR Data
@@ -162,4 +167,88 @@ void SetupLoop(const EDataMCTruth& type, const CCPi::MacroUtil& util,
   }
 }
 
+PlotUtils::ChainWrapper* CloneChainWrapper(PlotUtils::ChainWrapper* chain,
+                                           const int n_clones) {
+  assert(chain && "CloneChainWrapper: null chain");
+  TChain* source = chain->GetChain();
+  PlotUtils::ChainWrapper* clone = new PlotUtils::ChainWrapper(source->GetName());
+  TObjArray* file_elements = source->GetListOfFiles();
+  TIter next(file_elements);
+  TChainElement* element = nullptr;
+  while ((element = (TChainElement*)next())) clone->Add(element->GetTitle());
+  if (TList* statuses = source->GetStatus()) {
+    TIter next_status(statuses);
+    while ((element = (TChainElement*)next_status()))
+      clone->GetChain()->SetBranchStatus(element->GetName(),
+                                         element->GetStatus());
+  }
+  assert(n_clones > 0 && "CloneChainWrapper: need a number of clones");
+  const Long64_t cache_mb = source->GetCacheSize() / (1024 * 1024);
+  if (cache_mb > 0)
+    EnableReadAhead(clone, std::max<Long64_t>(1, cache_mb / n_clones));
+  return clone;
+}
+
+std::string GetBranchListFile(const std::string& prefix,
+                              PlotUtils::ChainWrapper* chain) {
+  return prefix + "_" + chain->GetChain()->GetName() + ".txt";
+}
+
+// A branch's read entry stays -1 until something calls GetEntry on it. Only
+// the current tree is checked, so call it before the chain loads the next.
+void RecordReadBranches(PlotUtils::ChainWrapper* chain,
+                        std::set<std::string>& branches) {
+  TTree* tree = chain->GetChain()->GetTree();
+  assert(tree && "RecordReadBranches: no entries have been loaded");
+  TIter next(tree->GetListOfBranches());
+  while (TBranch* branch = (TBranch*)next())
+    if (branch->GetReadEntry() >= 0) branches.insert(branch->GetName());
+}
+
+void WriteBranchList(const std::set<std::string>& branches,
+                     const std::string& filename) {
+  std::ofstream out(filename);
+  if (!out.good()) {
+    std::cerr << "WriteBranchList: can't open " << filename << "\n";
+    std::exit(1);
+  }
+  for (const auto& branch : branches) out << branch << "\n";
+  std::cout << "Recorded " << branches.size() << " branches to " << filename
+            << "\n";
+}
+
+void ActivateBranches(PlotUtils::ChainWrapper* chain,
+                      const std::string& filename) {
+  std::ifstream in(filename);
+  if (!in.good()) {
+    std::cerr << "ActivateBranches: can't open " << filename << "\n";
+    std::exit(1);
+  }
+  TChain* tchain = chain->GetChain();
+  tchain->SetBranchStatus("*", 0);
+  int n_active = 0;
+  std::string branch;
+  while (in >> branch) {
+    if (branch[0] == '#') {  // comment
+      std::getline(in, branch);
+      continue;
+    }
+    tchain->SetBranchStatus(branch.c_str(), 1);
+    ++n_active;
+  }
+  std::cout << "Activated " << n_active << " " << tchain->GetName()
+            << " branches from " << filename << "\n";
+}
+
+void EnableReadAhead(PlotUtils::ChainWrapper* chain, const int cache_mb) {
+  assert(cache_mb > 0 && "EnableReadAhead: need a cache size");
+  TChain* tchain = chain->GetChain();
+  tchain->SetCacheSize(Long64_t(cache_mb) * 1024 * 1024);
+  // Inactive branches aren't added
+  tchain->AddBranchToCache("*", kTRUE);
+  tchain->StopCacheLearningPhase();
+  std::cout << "Read-ahead of " << cache_mb << " MB for " << tchain->GetName()
+            << "\n";
+}
+
 #endif  // CCPiMacroUtil_cxx
@@ -9,8 +9,13 @@
 // * Extend PrintMacroConfiguration to print all the above
 // Helper functions:
 // SetupLoop
+// CloneChainWrapper
+// RecordReadBranches, WriteBranchList, ActivateBranches
+// EnableReadAhead
 //==============================================================================
 #include <cassert>
+#include <set>
+#include <string>
 
 #include "Constants.h"  // EDataMC for the SetupLoop function
 #include "PlotUtils/MacroUtil.h"
@@ -79,4 +84,41 @@ class MacroUtil : public PlotUtils::MacroUtil {
 void SetupLoop(const EDataMCTruth& type, const CCPi::MacroUtil& util,
                bool& is_mc, bool& is_truth, Long64_t& n_entries);
 
+// New ChainWrapper over the same tree and files as chain, with the same
+// branch statuses. Threads that read the same tuples each need their own,
+// since TChain isn't thread safe. If chain has a read-ahead cache, the clone
+// gets 1/n_clones of it, so that n_clones clones take about chain's memory.
+PlotUtils::ChainWrapper* CloneChainWrapper(PlotUtils::ChainWrapper* chain,
+                                           const int n_clones = 1);
+
+// Branch activation.
+// RecordReadBranches adds to branches the names of the branches of chain's
+// current tree that have been read (by GetDouble, GetInt, GetVecElem,
+// GetVec...). Call it for each tree of a run over every entry, before the
+// chain moves on to the next tree, then WriteBranchList writes the list file,
+// one name per line. ActivateBranches turns off every branch of chain not in
+// the list, so that they're never decompressed. MAT reads of a turned off
+// branch silently return stale values, so the list must come from a full run
+// with the production job's settings. The list file is named after the tree,
+// e.g. <prefix>_MasterAnaDev.txt.
+std::string GetBranchListFile(const std::string& prefix,
+                              PlotUtils::ChainWrapper* chain);
+void RecordReadBranches(PlotUtils::ChainWrapper* chain,
+                        std::set<std::string>& branches);
+void WriteBranchList(const std::set<std::string>& branches,
+                     const std::string& filename);
+void ActivateBranches(PlotUtils::ChainWrapper* chain,
+                      const std::string& filename);
+
+// Read-ahead. Gives chain a TTreeCache of cache_mb over its active branches,
+// with asynchronous prefetching: while the event loop works through the
+// entries of one cache block, ROOT's prefetch thread fetches the baskets of
+// the next. Reading (e.g. from dCache over xrootd) then overlaps the cuts,
+// weights, and fills. Call after ActivateBranches and before the first entry
+// is read. Costs about twice cache_mb of memory per chain. The prefetching
+// needs TFile.AsyncPrefetching, which is global: the macro sets it, once,
+// before any file is opened (e.g. gEnv->SetValue("TFile.AsyncPrefetching",
+// 1)). Without it, the cache still reads its blocks, but synchronously.
+void EnableReadAhead(PlotUtils::ChainWrapper* chain, const int cache_mb);
+
 #endif  // CCPiMacroUtil_h
@@ -10,7 +10,11 @@
 #ifndef Michel_H
 #define Michel_H
 
+#include <algorithm>  // copy
+#include <cassert>
 #include <ctime>
+#include <utility>  // pair
+#include <vector>
 
 #include "CVUniverse.h"
 
@@ -54,7 +58,102 @@ class Michel {
   double fit_distance;
 };
 
-typedef std::map<int, Michel> MichelMap;
+// Quality michels of an event, by cluster idx.
+//
+// A small sorted array with inline storage instead of a std::map, so that
+// matching and cutting michels doesn't allocate. Iterates like the map did:
+// pairs of (cluster idx, Michel), in idx order. Cuts remove michels in place
+// with EraseIf. An event has at most one michel per track endpoint; past
+// kInlineCapacity of them, the michels move to the heap.
+class MichelMap {
+ public:
+  typedef std::pair<int, Michel> value_type;
+  typedef value_type* iterator;
+  typedef const value_type* const_iterator;
+  static const size_t kInlineCapacity = 8;
+
+  MichelMap() : m_size(0) {}
+
+  // Only the michels are copied, not the whole inline array
+  MichelMap(const MichelMap& other)
+      : m_heap(other.m_heap), m_size(other.m_size) {
+    if (m_heap.empty()) std::copy(other.begin(), other.end(), m_inline);
+  }
+  MichelMap& operator=(const MichelMap& other) {
+    if (this == &other) return *this;
+    m_heap = other.m_heap;
+    m_size = other.m_size;
+    if (m_heap.empty()) std::copy(other.begin(), other.end(), m_inline);
+    return *this;
+  }
+
+  iterator begin() { return Items(); }
+  iterator end() { return Items() + m_size; }
+  const_iterator begin() const { return const_cast<MichelMap*>(this)->Items(); }
+  const_iterator end() const { return begin() + m_size; }
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  void clear() {
+    m_heap.clear();
+    m_size = 0;
+  }
+
+  // nullptr if no michel with cluster idx
+  Michel* Find(const int idx) {
+    iterator it = LowerBound(idx);
+    return it != end() && it->first == idx ? &it->second : nullptr;
+  }
+  const Michel* Find(const int idx) const {
+    return const_cast<MichelMap*>(this)->Find(idx);
+  }
+  size_t count(const int idx) const { return Find(idx) ? 1 : 0; }
+
+  // Add m under its cluster idx. m.idx must not be here already.
+  void Insert(const Michel& m) {
+    iterator it = LowerBound(m.idx);
+    assert((it == end() || it->first != m.idx) &&
+           "endpoint::MichelMap::Insert: cluster already matched");
+    const size_t pos = it - begin();
+    if (m_heap.empty() && m_size == kInlineCapacity)
+      m_heap.assign(m_inline, m_inline + m_size);
+    if (!m_heap.empty()) {
+      m_heap.insert(m_heap.begin() + pos, value_type(m.idx, m));
+    } else {
+      for (size_t i = m_size; i != pos; --i) m_inline[i] = m_inline[i - 1];
+      m_inline[pos] = value_type(m.idx, m);
+    }
+    ++m_size;
+  }
+
+  // Remove, in place and keeping order, the michels for which
+  // pred(const Michel&) is true.
+  template <class Pred>
+  void EraseIf(const Pred& pred) {
+    value_type* items = Items();
+    size_t n_kept = 0;
+    for (size_t i = 0; i < m_size; ++i) {
+      if (pred(items[i].second)) continue;
+      if (n_kept != i) items[n_kept] = items[i];
+      ++n_kept;
+    }
+    m_size = n_kept;
+    if (!m_heap.empty()) m_heap.resize(n_kept);
+  }
+
+ private:
+  // On the heap iff m_heap isn't empty, and then m_heap.size() == m_size
+  value_type* Items() { return m_heap.empty() ? m_inline : m_heap.data(); }
+
+  iterator LowerBound(const int idx) {
+    iterator it = begin();
+    while (it != end() && it->first < idx) ++it;
+    return it;
+  }
+
+  value_type m_inline[kInlineCapacity];
+  std::vector<value_type> m_heap;
+  size_t m_size;
+};
 
 Michel::Michel(const CVUniverse& univ, int i, int v)
     : idx(i),
@@ -95,25 +194,32 @@ Michel::Michel(const CVUniverse& univ, int i, int v)
   }
 }
 
+namespace {
+const BranchHandle kMatchedMichelEndDist("matched_michel_end_dist");
+const BranchHandle kMatchedMichelAvgDist("matched_michel_avg_dist");
+const BranchHandle kMatchedMichelOVDist("matched_michel_ov_dist");
+const BranchHandle kMatchedMichelIdx("matched_michel_idx");
+}  // namespace
+
 double Michel::GetDistMichel(const CVUniverse& univ,
                              const EMatchCategory match_strategy,
                              const unsigned int vtx) const {
-  std::string branch_name;
+  const BranchHandle* branch = nullptr;
   switch (match_strategy) {
     case kFit:
-      branch_name = "matched_michel_end_dist";
+      branch = &kMatchedMichelEndDist;
       break;
     case kNoFit:
-      branch_name = "matched_michel_avg_dist";
+      branch = &kMatchedMichelAvgDist;
       break;
     case kOV:
-      branch_name = "matched_michel_ov_dist";
+      branch = &kMatchedMichelOVDist;
       break;
     default:
       return -1.;
   }
-  double match_dist = univ.GetVecElem(branch_name.c_str(), vtx);  // mm
-  match_dist = match_dist / 10.;                                  // cm
+  double match_dist = univ.Read(*branch, vtx);  // mm
+  match_dist = match_dist / 10.;                // cm
 
   // IF bogus match distance then throw an error. Distances greater than
   // epsilon and less than 5 m. This still happens now and then.
@@ -148,7 +254,7 @@ bool IsQualityMatchedMichel_OneView(const double ov_dist, const double ov_cut) {
 
 // -- Given a single michel cluster matched to two vertices
 //    return vertex with the better-matched michel.
-Michel CompareMichels(Michel r, Michel c) {
+const Michel& CompareMichels(const Michel& r, const Michel& c) {
   if (r.match_category > c.match_category)
     return r;
   else if (r.match_category < c.match_category)
@@ -168,15 +274,12 @@ Michel CompareMichels(Michel r, Michel c) {
 
 // Add michel to MichelMap. Check if this cluster has already been matched.
 // Then use only the best match.
-bool AddOrReplaceMichel(MichelMap& mm, Michel m) {
-  std::pair<MichelMap::iterator, bool> SC;
-  if (mm.count(m.idx) == 0)
-    SC = mm.insert(pair<int, Michel>(m.idx, m));
-  else {
-    Michel reigning_michel = mm.at(m.idx);
-    Michel best_michel = CompareMichels(reigning_michel, m);
-    mm[m.idx] = best_michel;
-  }
+bool AddOrReplaceMichel(MichelMap& mm, const Michel& m) {
+  Michel* reigning_michel = mm.Find(m.idx);
+  if (!reigning_michel)
+    mm.Insert(m);
+  else
+    *reigning_michel = CompareMichels(*reigning_michel, m);
   return true;
 }
 
@@ -199,12 +302,12 @@ bool AddOrReplaceMichel(MichelMap& mm, Michel m) {
 //   interaction vertex michel. We'd like to call these signal, but we don't
 //   know the pion energy...yet. In the meantime, cut them.
 MichelMap GetQualityMichels(const CVUniverse& univ) {
-  std::map<int, Michel> ret_michels;
-  std::vector<int> matched_michel_idxs = univ.GetVec<int>("matched_michel_idx");
+  MichelMap ret_michels;
+  const int n_vertices = univ.ReadLength(kMatchedMichelIdx);
 
   // Loop vertices in the event, i.e. the indices of the michel index vector
-  for (uint vtx = 0; vtx < matched_michel_idxs.size(); ++vtx) {
-    int mm_idx = matched_michel_idxs[vtx];
+  for (int vtx = 0; vtx < n_vertices; ++vtx) {
+    int mm_idx = univ.ReadInt(kMatchedMichelIdx, vtx);
 
     // NO MATCH -- GO TO NEXT VTX. No michel cluster matched to this vertex.
     if (mm_idx < 0) continue;
@@ -240,7 +343,7 @@ MichelMap GetQualityMichels(const CVUniverse& univ) {
     // -- If either the michel we have already or this michel is OV, pick
     //    the better of the two. Only one will remain.
     else if (ret_michels.size() == 1) {
-      Michel reigning_michel = (ret_michels.begin())->second;
+      const Michel reigning_michel = ret_michels.begin()->second;
       if (reigning_michel.match_category == Michel::kOV ||
           current_michel.match_category == Michel::kOV)
         ret_michels.clear();
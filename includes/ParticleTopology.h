@@ -0,0 +1,127 @@
+#ifndef ParticleTopology_h
+#define ParticleTopology_h
+
+//==============================================================================
+// Truth topology particle counts (from Aaron), by category.
+//
+// Each final state PDG code maps to a bit mask of the categories it counts
+// toward, e.g. a pi+ counts as piplus, pions, and mesons. The explicitly
+// classified codes are in kPDGCategories; everything else is a heavy baryon,
+// a nucleus, or an other. Counting is a fixed-size array, so classifying an
+// event doesn't allocate.
+//
+// No ROOT or MAT dependencies, so that stand-alone programs (e.g.
+// xsec/runXSecLooper.cpp) can share it.
+//==============================================================================
+#include <vector>
+
+namespace topology {
+enum EParticleCategory {
+  kMuons,
+  kPhotons,  // Photons are filled if there are electrons
+  kPiZeros,
+  kPiPlus,
+  kPiPlusRange,  // Pi+ that passes the kinematic cuts
+  kPiMinus,
+  kPions,
+  kKaons,
+  kCharms,
+  kMesons,
+  kProtons,
+  kNeutrons,
+  kNucleons,
+  kHeavyBaryons,
+  kNuclei,
+  kOthers,
+  kNParticleCategories
+};
+
+constexpr unsigned int Bit(const EParticleCategory c) { return 1u << c; }
+
+struct PDGCategories {
+  int pdg;
+  unsigned int categories;
+};
+
+// kPiPlusRange also depends on the pion's energy, and photons below 10 MeV
+// aren't counted. Both are handled by GetParticleTopology.
+constexpr PDGCategories kPDGCategories[] = {
+    {13, Bit(kMuons)},
+    {22, Bit(kPhotons)},
+    {11, Bit(kPhotons)},
+    {-11, Bit(kPhotons)},
+    {211, Bit(kPiPlus) | Bit(kPions) | Bit(kMesons)},
+    {-211, Bit(kPiMinus) | Bit(kPions) | Bit(kMesons)},
+    {111, Bit(kPiZeros) | Bit(kPions) | Bit(kMesons)},
+    {130, Bit(kKaons) | Bit(kMesons)},
+    {310, Bit(kKaons) | Bit(kMesons)},
+    {311, Bit(kKaons) | Bit(kMesons)},
+    {321, Bit(kKaons) | Bit(kMesons)},
+    {-130, Bit(kKaons) | Bit(kMesons)},
+    {-310, Bit(kKaons) | Bit(kMesons)},
+    {-311, Bit(kKaons) | Bit(kMesons)},
+    {-321, Bit(kKaons) | Bit(kMesons)},
+    {411, Bit(kCharms) | Bit(kMesons)},
+    {421, Bit(kCharms) | Bit(kMesons)},
+    {431, Bit(kCharms) | Bit(kMesons)},
+    {-411, Bit(kCharms) | Bit(kMesons)},
+    {-421, Bit(kCharms) | Bit(kMesons)},
+    {-431, Bit(kCharms) | Bit(kMesons)},
+    {2212, Bit(kProtons) | Bit(kNucleons)},
+    {2112, Bit(kNeutrons) | Bit(kNucleons)},
+    {2000000101, 0u},  // bindino is binding energy placeholder
+};
+
+// Categories that pdg counts toward
+inline unsigned int GetPDGCategories(const int pdg) {
+  for (const auto& entry : kPDGCategories)
+    if (entry.pdg == pdg) return entry.categories;
+  if (pdg > 3000 && pdg < 5000) return Bit(kHeavyBaryons);
+  if (pdg > 1000000000 && pdg < 1099999999) return Bit(kNuclei);
+  return Bit(kOthers);
+}
+
+struct ParticleTopology {
+  int n[kNParticleCategories];
+  ParticleTopology() {
+    for (int& count : n) count = 0;
+  }
+  int operator[](const EParticleCategory c) const { return n[c]; }
+};
+
+// Final state particles, with energies in MeV. A pi+ is in range if
+// tpi_min < E - pion_mass < tpi_max.
+inline ParticleTopology GetParticleTopology(const std::vector<int>& FS_PDG,
+                                            const std::vector<double>& FS_energy,
+                                            const double tpi_min,
+                                            const double tpi_max,
+                                            const double pion_mass) {
+  ParticleTopology topology;
+  for (size_t p = 0; p < FS_PDG.size(); ++p) {
+    const int pdg = FS_PDG[p];
+    // Photons below 10 MeV are nuclear deexcitations, which we ignore
+    if (pdg == 22 && !(FS_energy[p] > 10)) continue;
+    unsigned int categories = GetPDGCategories(pdg);
+    if (pdg == 211) {
+      const double tpi = FS_energy[p] - pion_mass;
+      if (tpi_min < tpi && tpi < tpi_max) categories |= Bit(kPiPlusRange);
+    }
+    for (int c = 0; categories; ++c, categories >>= 1)
+      if (categories & 1u) ++topology.n[c];
+  }
+  return topology;
+}
+
+// Given the particle topology, is this signal? 1 mu, 1 pi+, no other mesons,
+// any number of baryons, nothing else.
+inline bool Is1PiPlus(const ParticleTopology& particles) {
+  const int n_bg = particles[kPhotons] + particles[kPiZeros] +
+                   particles[kPiMinus] + particles[kKaons] +
+                   particles[kCharms] + particles[kOthers];
+  return particles[kMuons] == 1 && particles[kPiPlus] == 1 &&
+         particles[kPions] == particles[kPiPlus] &&
+         particles[kMesons] == particles[kPiPlus] && n_bg == 0;
+}
+}  // namespace topology
+
+#endif  // ParticleTopology_h
@@ -0,0 +1,134 @@
+#ifndef ProgressReporter_h
+#define ProgressReporter_h
+
+//==============================================================================
+// Progress of an event loop.
+//
+// ProgressReporter progress("MC reco", n_entries, n_universes);
+// for (Long64_t i_event = 0; i_event < n_entries; ++i_event) {
+//   progress.Update(i_event);
+//   ...
+// }
+// progress.Finish();
+//
+// At most every interval seconds, prints entries done, events/s, universe
+// fills/s (events/s times universes_per_entry), ETA, peak RSS, and bytes read
+// by ROOT files. Finish prints one summary line for log scrapers:
+//
+// PROGRESS_SUMMARY name=<name> entries=<n> sec=<t> evt_per_sec=<r> ...
+//==============================================================================
+#include <sys/resource.h>  // getrusage
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "Constants.h"  // EDataMCTruth
+#include "Rtypes.h"     // Long64_t
+#include "TFile.h"      // TFile::GetFileBytesRead
+
+class ProgressReporter {
+ public:
+  ProgressReporter(const std::string& name, const Long64_t n_entries,
+                   const int universes_per_entry = 1,
+                   const double interval = 30.)
+      : m_name(name),
+        m_n_entries(n_entries),
+        m_universes_per_entry(universes_per_entry),
+        m_interval(interval),
+        m_n_done(0),
+        m_start(Clock::now()),
+        m_last_print(m_start),
+        m_bytes_read_start(TFile::GetFileBytesRead()) {
+    std::cout << "*** " << m_name << ": " << m_n_entries << " entries ***"
+              << std::endl;
+  }
+
+  // Call once per entry. Only looks at the clock every kCheckEvery entries.
+  void Update(const Long64_t i_event) {
+    ++m_n_done;
+    if (m_n_done % kCheckEvery != 0) return;
+    const Clock::time_point now = Clock::now();
+    if (Seconds(m_last_print, now) < m_interval) return;
+    m_last_print = now;
+    Print(i_event, now);
+  }
+
+  void Finish() const {
+    const double sec = Seconds(m_start, Clock::now());
+    const double rate = sec > 0. ? m_n_done / sec : 0.;
+    std::cout << "PROGRESS_SUMMARY name=" << Tag() << " entries=" << m_n_done
+              << std::fixed << std::setprecision(1) << " sec=" << sec
+              << " evt_per_sec=" << rate
+              << " fills_per_sec=" << rate * m_universes_per_entry
+              << " peak_rss_mb=" << PeakRSSMB() << " bytes_read="
+              << TFile::GetFileBytesRead() - m_bytes_read_start
+              << std::defaultfloat << std::endl;
+  }
+
+  // Peak resident memory of this process
+  static double PeakRSSMB() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.;  // kB on linux
+  }
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+  static const Long64_t kCheckEvery = 256;
+
+  static double Seconds(const Clock::time_point& a,
+                        const Clock::time_point& b) {
+    return std::chrono::duration<double>(b - a).count();
+  }
+
+  // name, without spaces
+  std::string Tag() const {
+    std::string tag = m_name;
+    for (auto& c : tag)
+      if (c == ' ') c = '_';
+    return tag;
+  }
+
+  void Print(const Long64_t i_event, const Clock::time_point& now) const {
+    const double sec = Seconds(m_start, now);
+    const double rate = m_n_done / sec;
+    const double eta = rate > 0. ? (m_n_entries - m_n_done) / rate : 0.;
+    std::ostringstream os;
+    os << m_name << ": " << (i_event / 1000) << "k (" << std::fixed
+       << std::setprecision(1) << 100. * m_n_done / m_n_entries << "%) "
+       << rate << " evt/s " << rate * m_universes_per_entry << " fills/s"
+       << " ETA " << int(eta / 60.) << "m" << int(eta) % 60 << "s"
+       << " RSS " << PeakRSSMB() << "MB read "
+       << (TFile::GetFileBytesRead() - m_bytes_read_start) / (1024. * 1024.)
+       << "MB";
+    std::cout << os.str() << std::endl;
+  }
+
+  const std::string m_name;
+  const Long64_t m_n_entries;
+  const int m_universes_per_entry;
+  const double m_interval;  // sec
+  Long64_t m_n_done;
+  const Clock::time_point m_start;
+  Clock::time_point m_last_print;
+  const Long64_t m_bytes_read_start;
+};
+
+// Name for the progress of a SetupLoop loop
+inline std::string GetLoopName(const EDataMCTruth& type) {
+  switch (type) {
+    case kData:
+      return "Data";
+    case kMC:
+      return "MC reco";
+    case kTruth:
+      return "Truth";
+    default:
+      return "Loop";
+  }
+}
+
+#endif  // ProgressReporter_h
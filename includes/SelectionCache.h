@@ -0,0 +1,361 @@
+#ifndef SelectionCache_h
+#define SelectionCache_h
+
+//==============================================================================
+// Sidecar files of each entry's event selection, so that a rerun with new
+// binnings, weights, or variables can skip the cuts and the trackless michel
+// reco, and go straight to weighting and filling.
+//
+// Writing, per entry:
+//   writer.SetTracklessMichels(good_trackless_michels, trackless_michels);
+//   writer.SetSlot(slot, event);  // for each slot
+//   writer.Fill(i_event);
+// Reading, per entry:
+//   reader.LoadEntry(i_event);
+//   if (!reader.IsSelected()) continue;
+//   good_trackless_michels = reader.GetTracklessMichels(cv, trackless_michels);
+//   reader.Apply(slot, event);  // for each slot
+//
+// A slot is a universe that makes its own cuts: the CV (slot 0), then the
+// lateral universes in error band order (GetSlotUniverses). Vertical-only
+// universes take the CV's selection, as they do in the event loops.
+//
+// Per entry and slot, a row keeps CCPiEvent's six pass flags, its pion
+// candidates and highest energy candidate, and its W sideband type. Per
+// entry, it keeps the CV's trackless michel result: whether it passed, and the
+// best michel's tuple index, distance, and angle. Only the MichelEvent members
+// that this analysis reads are restored.
+//
+// Each loop over entries [first, last) writes its own part,
+// <prefix>_<first>.root, so threaded loops can write too. A reader chains
+// <prefix>_*.root and requires row i to be entry i, so delete old parts
+// before writing new ones. Each part also keeps the slot names and a tag
+// (e.g. playlist and signal definition) that the reader checks.
+//==============================================================================
+#include <cstdlib>    // exit
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CCPiEvent.h"
+#include "CVUniverse.h"
+#include "Constants.h"  // UniverseMap
+#include "PlotUtils/LowRecoilPionReco.h"
+#include "TChain.h"
+#include "TChainElement.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TNamed.h"
+#include "TTree.h"
+
+namespace selection_cache {
+enum EMode { kOff, kWrite, kRead };
+
+struct Config {
+  EMode mode = kOff;
+  std::string prefix;  // parts are <prefix>_<first entry>.root
+  std::string tag;     // what the selection was made with
+};
+
+// Initial room for pion candidates per slot. The buffers grow as needed.
+const int kCandidatesPerSlot = 4;
+
+enum EFlag {
+  kPassesCuts,
+  kPassesTracklessCuts,
+  kIsWSideband,
+  kPassesTracklessSideband,
+  kPassesAllCutsExceptW,
+  kPassesTracklessCutsExceptW
+};
+
+inline UChar_t Bit(const EFlag f) { return UChar_t(1u << f); }
+
+// The universes that make their own cuts: the CV, then each lateral universe
+inline std::vector<CVUniverse*> GetSlotUniverses(
+    const UniverseMap& error_bands) {
+  std::vector<CVUniverse*> universes = {error_bands.at("cv").at(0)};
+  for (const auto& band : error_bands)
+    for (auto universe : band.second)
+      if (!universe->IsVerticalOnly()) universes.push_back(universe);
+  return universes;
+}
+
+// Names of GetSlotUniverses, <band>_<index in band>
+inline std::vector<std::string> GetSlotNames(const UniverseMap& error_bands) {
+  std::vector<std::string> names = {"cv_0"};
+  for (const auto& band : error_bands)
+    for (size_t i = 0; i < band.second.size(); ++i)
+      if (!band.second[i]->IsVerticalOnly())
+        names.push_back(band.first + "_" + std::to_string(i));
+  return names;
+}
+
+inline std::string JoinSlotNames(const std::vector<std::string>& names) {
+  std::string joined;
+  for (const auto& name : names) joined += (joined.empty() ? "" : ",") + name;
+  return joined;
+}
+
+// One entry's branches
+struct Row {
+  explicit Row(const int n_slots)
+      : flags(n_slots, 0),
+        w_type(n_slots, kNWSidebandTypes),
+        highest_energy_pion(n_slots, -300),
+        n_candidates(n_slots, 0),
+        n_all_candidates(0),
+        candidates(n_slots * kCandidatesPerSlot, -1) {}
+
+  void Branch(TTree& tree) {
+    const int n_slots = flags.size();
+    tree.Branch("entry", &entry, "entry/L");
+    tree.Branch("good_trackless_michels", &good_trackless_michels,
+                "good_trackless_michels/O");
+    tree.Branch("michel_tuple_idx", &michel_tuple_idx, "michel_tuple_idx/I");
+    tree.Branch("michel_best_dist", &michel_best_dist, "michel_best_dist/D");
+    tree.Branch("michel_best_theta", &michel_best_theta,
+                "michel_best_theta/D");
+    tree.Branch("flags", flags.data(), Form("flags[%d]/b", n_slots));
+    tree.Branch("w_type", w_type.data(), Form("w_type[%d]/I", n_slots));
+    tree.Branch("highest_energy_pion", highest_energy_pion.data(),
+                Form("highest_energy_pion[%d]/I", n_slots));
+    tree.Branch("n_candidates", n_candidates.data(),
+                Form("n_candidates[%d]/I", n_slots));
+    tree.Branch("n_all_candidates", &n_all_candidates, "n_all_candidates/I");
+    tree.Branch("candidates", candidates.data(),
+                "candidates[n_all_candidates]/I");
+  }
+
+  void SetBranchAddresses(TTree& tree) {
+    tree.SetBranchAddress("entry", &entry);
+    tree.SetBranchAddress("good_trackless_michels", &good_trackless_michels);
+    tree.SetBranchAddress("michel_tuple_idx", &michel_tuple_idx);
+    tree.SetBranchAddress("michel_best_dist", &michel_best_dist);
+    tree.SetBranchAddress("michel_best_theta", &michel_best_theta);
+    tree.SetBranchAddress("flags", flags.data());
+    tree.SetBranchAddress("w_type", w_type.data());
+    tree.SetBranchAddress("highest_energy_pion", highest_energy_pion.data());
+    tree.SetBranchAddress("n_candidates", n_candidates.data());
+    tree.SetBranchAddress("n_all_candidates", &n_all_candidates);
+    tree.SetBranchAddress("candidates", candidates.data());
+  }
+
+  // Make room for n candidates, and point tree's branch at the new buffer
+  void ReserveCandidates(TTree& tree, const int n) {
+    if (n <= int(candidates.size())) return;
+    candidates.resize(n, -1);
+    tree.SetBranchAddress("candidates", candidates.data());
+  }
+
+  Long64_t entry = -1;
+  Bool_t good_trackless_michels = false;
+  Int_t michel_tuple_idx = -1;  // -1 if no best trackless michel
+  Double_t michel_best_dist = 0.;
+  Double_t michel_best_theta = 0.;
+  // by slot
+  std::vector<UChar_t> flags;  // Bit(EFlag)
+  std::vector<Int_t> w_type;
+  std::vector<Int_t> highest_energy_pion;
+  std::vector<Int_t> n_candidates;
+  // every slot's candidates, slot after slot
+  Int_t n_all_candidates;
+  std::vector<Int_t> candidates;
+};
+
+class Writer {
+ public:
+  // Must be made and destroyed on the thread that fills it
+  Writer(const Config& config, const std::vector<std::string>& slot_names,
+         const Long64_t first_entry)
+      : m_row(slot_names.size()), m_slot_candidates(slot_names.size()) {
+    TDirectory::TContext context;
+    const std::string name =
+        Form("%s_%012lld.root", config.prefix.c_str(), first_entry);
+    m_file = TFile::Open(name.c_str(), "RECREATE");
+    if (!m_file || m_file->IsZombie()) {
+      std::cerr << "selection_cache::Writer: can't open " << name << "\n";
+      std::exit(1);
+    }
+    TNamed("selection_tag", config.tag.c_str()).Write();
+    TNamed("selection_slots", JoinSlotNames(slot_names).c_str()).Write();
+    m_tree = new TTree("selection", "Event selection by universe");
+    m_row.Branch(*m_tree);
+  }
+
+  ~Writer() {
+    TDirectory::TContext context(m_file);
+    m_tree->Write();
+    m_file->Close();
+    delete m_file;
+  }
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+  void SetTracklessMichels(
+      const bool good_trackless_michels,
+      const LowRecoilPion::MichelEvent<CVUniverse>& trackless_michels) {
+    m_row.good_trackless_michels = good_trackless_michels;
+    m_row.michel_tuple_idx =
+        trackless_michels.m_idx != -1
+            ? trackless_michels.m_nmichels[trackless_michels.m_idx].tuple_idx
+            : -1;
+    m_row.michel_best_dist = trackless_michels.m_bestdist;
+    m_row.michel_best_theta = trackless_michels.m_bestthetaangle;
+  }
+
+  // Different slots can be set from different threads
+  void SetSlot(const int slot, const CCPiEvent& event) {
+    const std::vector<RecoPionIdx>& candidates =
+        event.m_reco_pion_candidate_idxs;
+    m_row.flags[slot] =
+        (event.m_passes_cuts ? Bit(kPassesCuts) : 0) |
+        (event.m_passes_trackless_cuts ? Bit(kPassesTracklessCuts) : 0) |
+        (event.m_is_w_sideband ? Bit(kIsWSideband) : 0) |
+        (event.m_passes_trackless_sideband ? Bit(kPassesTracklessSideband)
+                                           : 0) |
+        (event.m_passes_all_cuts_except_w ? Bit(kPassesAllCutsExceptW) : 0) |
+        (event.m_passes_trackless_cuts_except_w
+             ? Bit(kPassesTracklessCutsExceptW)
+             : 0);
+    m_row.w_type[slot] = event.m_w_type;
+    m_row.highest_energy_pion[slot] = event.m_highest_energy_pion_idx;
+    m_row.n_candidates[slot] = candidates.size();
+    m_slot_candidates[slot].assign(candidates.begin(), candidates.end());
+  }
+
+  // Write the entry, once all of its slots are set
+  void Fill(const Long64_t entry) {
+    m_row.entry = entry;
+    int n_all_candidates = 0;
+    for (const auto& candidates : m_slot_candidates)
+      n_all_candidates += candidates.size();
+    m_row.ReserveCandidates(*m_tree, n_all_candidates);
+    m_row.n_all_candidates = 0;
+    for (const auto& candidates : m_slot_candidates)
+      for (const RecoPionIdx candidate : candidates)
+        m_row.candidates[m_row.n_all_candidates++] = candidate;
+    m_tree->Fill();
+  }
+
+ private:
+  TFile* m_file;
+  TTree* m_tree;  // owned by m_file
+  Row m_row;
+  std::vector<std::vector<Int_t>> m_slot_candidates;  // by slot
+};
+
+class Reader {
+ public:
+  Reader(const Config& config, const std::vector<std::string>& slot_names)
+      : m_chain("selection"),
+        m_row(slot_names.size()),
+        m_offsets(slot_names.size(), 0) {
+    const std::string parts = config.prefix + "_*.root";
+    if (m_chain.Add(parts.c_str()) == 0) {
+      std::cerr << "selection_cache::Reader: no files " << parts << "\n";
+      std::exit(1);
+    }
+    // Every part was made with this configuration and these universes
+    const std::string slots = JoinSlotNames(slot_names);
+    TDirectory::TContext context;
+    TIter next(m_chain.GetListOfFiles());
+    while (TChainElement* element = (TChainElement*)next()) {
+      TFile part(element->GetTitle(), "READ");
+      TNamed* tag = (TNamed*)part.Get("selection_tag");
+      TNamed* part_slots = (TNamed*)part.Get("selection_slots");
+      if (!tag || config.tag != tag->GetTitle() || !part_slots ||
+          slots != part_slots->GetTitle()) {
+        std::cerr << "selection_cache::Reader: " << element->GetTitle()
+                  << " was made with a different configuration ("
+                  << (tag ? tag->GetTitle() : "no tag") << ") or universes\n";
+        std::exit(1);
+      }
+    }
+    m_n_rows = m_chain.GetEntries();
+    m_row.SetBranchAddresses(m_chain);
+  }
+
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
+  void LoadEntry(const Long64_t entry) {
+    const Long64_t local_entry =
+        entry < m_n_rows ? m_chain.LoadTree(entry) : -1;
+    if (local_entry >= 0) {
+      // The candidate count first, to make room for the candidates
+      m_chain.GetTree()->GetBranch("n_all_candidates")->GetEntry(local_entry);
+      m_row.ReserveCandidates(m_chain, m_row.n_all_candidates);
+    }
+    if (local_entry < 0 || m_chain.GetEntry(entry) <= 0 ||
+        m_row.entry != entry) {
+      std::cerr << "selection_cache::Reader: no row for entry " << entry
+                << ". Are there stale or missing parts?\n";
+      std::exit(1);
+    }
+    int offset = 0;
+    for (size_t slot = 0; slot < m_offsets.size(); ++slot) {
+      m_offsets[slot] = offset;
+      offset += m_row.n_candidates[slot];
+    }
+  }
+
+  // Whether any slot passed anything. Reco fills need some pass flag, so an
+  // entry that isn't selected can be skipped.
+  bool IsSelected() const {
+    for (const UChar_t flags : m_row.flags)
+      if (flags) return true;
+    return false;
+  }
+
+  // The CV's trackless michels. Returns whether they passed the michel cuts.
+  bool GetTracklessMichels(
+      const CVUniverse& cv,
+      LowRecoilPion::MichelEvent<CVUniverse>& trackless_michels) const {
+    trackless_michels = LowRecoilPion::MichelEvent<CVUniverse>();
+    if (m_row.michel_tuple_idx != -1) {
+      trackless_michels.m_nmichels.push_back(
+          LowRecoilPion::Michel<CVUniverse>(cv, m_row.michel_tuple_idx));
+      trackless_michels.m_idx = 0;
+    }
+    trackless_michels.m_bestdist = m_row.michel_best_dist;
+    trackless_michels.m_bestthetaangle = m_row.michel_best_theta;
+    return m_row.good_trackless_michels;
+  }
+
+  // Set slot's selection to event and its universe. Slots can be applied
+  // from different threads.
+  void Apply(const int slot, CCPiEvent& event) const {
+    const UChar_t flags = m_row.flags[slot];
+    event.m_passes_cuts = flags & Bit(kPassesCuts);
+    event.m_passes_trackless_cuts = flags & Bit(kPassesTracklessCuts);
+    event.m_is_w_sideband = flags & Bit(kIsWSideband);
+    event.m_passes_trackless_sideband = flags & Bit(kPassesTracklessSideband);
+    event.m_passes_all_cuts_except_w = flags & Bit(kPassesAllCutsExceptW);
+    event.m_passes_trackless_cuts_except_w =
+        flags & Bit(kPassesTracklessCutsExceptW);
+    event.m_w_type = WSidebandType(m_row.w_type[slot]);
+    event.m_highest_energy_pion_idx = m_row.highest_energy_pion[slot];
+    const auto first = m_row.candidates.begin() + m_offsets[slot];
+    event.m_reco_pion_candidate_idxs.assign(
+        first, first + m_row.n_candidates[slot]);
+
+    CVUniverse* universe = event.m_universe;
+    universe->SetPionCandidates(event.m_reco_pion_candidate_idxs);
+    universe->SetPassesTrakedTracklessCuts(
+        event.m_passes_cuts, event.m_passes_trackless_cuts,
+        event.m_is_w_sideband, event.m_passes_trackless_sideband,
+        event.m_passes_all_cuts_except_w,
+        event.m_passes_trackless_cuts_except_w);
+  }
+
+ private:
+  TChain m_chain;
+  Row m_row;
+  Long64_t m_n_rows;
+  std::vector<int> m_offsets;  // of each slot's candidates, in m_row
+};
+}  // namespace selection_cache
+
+#endif  // SelectionCache_h
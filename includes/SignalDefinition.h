@@ -2,6 +2,7 @@
 #define SignalDefinition_H
 
 #include "includes/CVUniverse.h"
+#include "includes/ParticleTopology.h"
 
 //==============================================================================
 
@@ -213,139 +214,12 @@ int SignalDefinition::kNSigDefs = 0;
 
 //==============================================================================
 
-// Truth topology particle counts
-// From Aaron
-std::map<string, int> GetParticleTopology(const std::vector<int>& FS_PDG,
-                                          const std::vector<double>& FS_energy,
-                                          const SignalDefinition sig_def) {
-  std::map<std::string, int> genie_n;
-
-  // Overarching categories: nucleons, mesons
-  genie_n["muons"] = 0;     // Muons, photons (do we want electrons...)
-  genie_n["photons"] = 0;   // Photons are filled if there are electrons
-  genie_n["pi_zeros"] = 0;  // Pions
-  genie_n["piplus"] = 0;
-  genie_n["piplus_range"] = 0;  // Pi+ that passes the kinematic cuts
-  genie_n["piminus"] = 0;
-  genie_n["pions"] = 0;
-  genie_n["kaons"] = 0;  // Other mesons
-  genie_n["charms"] = 0;
-  genie_n["mesons"] = 0;
-  genie_n["protons"] = 0;  // Baryons
-  genie_n["neutrons"] = 0;
-  genie_n["nucleons"] = 0;
-  genie_n["heavy_baryons"] = 0;
-  genie_n["nuclei"] = 0;
-  genie_n["others"] = 0;  // others
-
-  double tpi = 0;
-  for (uint p = 0; p < FS_PDG.size(); p++) {
-    // Get tpi
-    tpi = (FS_energy[p] - MinervaUnits::M_pion);
-
-    // Look at every particle's pdg
-    switch (FS_PDG[p]) {
-      case 13:
-        genie_n["muons"]++;
-        break;
-      case 22:
-        // Check the energy.  If below 10 MeV, it's a nuclear deexcitation,
-        // which we ignore
-        if (FS_energy[p] > 10) genie_n["photons"]++;
-        break;
-      case 11:
-      case -11:
-        genie_n["photons"]++;
-        break;
-      case 211:
-        if (sig_def.m_tpi_min < tpi && tpi < sig_def.m_tpi_max)
-          genie_n["piplus_range"]++;
-        genie_n["piplus"]++;
-        genie_n["pions"]++;
-        genie_n["mesons"]++;
-        break;
-      case -211:
-        genie_n["piminus"]++;
-        genie_n["pions"]++;
-        genie_n["mesons"]++;
-        break;
-      case 111:
-        genie_n["pi_zeros"]++;
-        // genie_n["photons"]++;
-        genie_n["pions"]++;
-        genie_n["mesons"]++;
-        break;
-      case 130:
-      case 310:
-      case 311:
-      case 321:
-      case -130:
-      case -310:
-      case -311:
-      case -321:
-        genie_n["kaons"]++;
-        genie_n["mesons"]++;
-        break;
-      case 411:
-      case 421:
-      case 431:
-      case -411:
-      case -421:
-      case -431:
-        genie_n["charms"]++;
-        genie_n["mesons"]++;
-        break;
-      case 2212:
-        genie_n["protons"]++;
-        genie_n["nucleons"]++;
-        break;
-      case 2112:
-        genie_n["neutrons"]++;
-        genie_n["nucleons"]++;
-        break;
-      case 2000000101:  // bindino is binding energy placeholder
-        break;
-      default:
-        if (FS_PDG[p] > 3000 && FS_PDG[p] < 5000)
-          genie_n["heavy_baryons"]++;
-        else if (FS_PDG[p] > 1000000000 && FS_PDG[p] < 1099999999)
-          genie_n["nuclei"]++;
-        else
-          genie_n["others"]++;
-    }
-  }
-
-  return genie_n;
-}
-
-// Given the particle topology of GetParticleTopology, is this signal?
-// From Aaron
-bool Is1PiPlus(const std::map<std::string, int>& particles) {
-  //  if( incoming =! 14 || current =! 1 ) return false;
-
-  // which particles are part of your signal (those you count, those you want
-  // any) Don't need two variables, just here to keep bookkeeping straight
-  TString counted_signal("muons piplus piplus_range pions mesons");
-  TString any_baryon("protons neutrons nucleons heavy_baryons nuclei");
-
-  // Count bkgd particles
-  int n_bg = 0;
-  for (auto p : particles) {
-    std::string particle = p.first;
-    int count = p.second;
-    if (counted_signal.Contains(particle) || any_baryon.Contains(particle))
-      continue;
-    n_bg += count;
-  }
-
-  // SIGNAL
-  // 1 mu, 1 pi+, no other mesons
-  if (particles.at("muons") == 1 && particles.at("piplus") == 1 &&
-      particles.at("pions") == particles.at("piplus") &&
-      particles.at("mesons") == particles.at("piplus") && n_bg == 0)
-    return true;  // any number of baryons, nothing else
-
-  return false;
+// Truth topology particle counts (see ParticleTopology.h)
+topology::ParticleTopology GetParticleTopology(
+    const std::vector<int>& FS_PDG, const std::vector<double>& FS_energy,
+    const SignalDefinition sig_def) {
+  return topology::GetParticleTopology(FS_PDG, FS_energy, sig_def.m_tpi_min,
+                                       sig_def.m_tpi_max, MinervaUnits::M_pion);
 }
 
 // Number of abs(pdg) == 211 true TG4Trajectories which also:
@@ -389,24 +263,28 @@ bool XYVtxIsSignal(const CVUniverse& univ, const SignalDefinition sig_def) {
 
 bool IsSignal(const CVUniverse& univ,
               SignalDefinition sig_def = SignalDefinition::OnePi()) {
-  unsigned int n_signal_pions = NSignalPions(univ, sig_def);
-
-  const std::map<std::string, int> particles =
+  // Cheapest first. Most truth events fail the current, flavor, or fiducial
+  // checks and never need the topology or pion count.
+  if (!(univ.GetInt("mc_current") == 1 && univ.GetInt("mc_incoming") == 14 &&
+        univ.GetBool("truth_is_fiducial") && ZVtxIsSignal(univ, sig_def) &&
+        XYVtxIsSignal(univ, sig_def)))
+    return false;
+
+  const topology::ParticleTopology particles =
       GetParticleTopology(univ.GetVec<int>("mc_FSPartPDG"),
                           univ.GetVec<double>("mc_FSPartE"), sig_def);
+  if (!(particles[topology::kPiPlusRange] == 1 &&
+        topology::Is1PiPlus(particles)))
+    return false;
 
   // TODO switch the pion multiplicity check to use the particles variable
-  // TODO Is1PiPlus obviously isn't checking for any number of pions
-  return univ.GetInt("mc_current") == 1 && univ.GetInt("mc_incoming") == 14 &&
-         univ.GetBool("truth_is_fiducial") && ZVtxIsSignal(univ, sig_def) &&
-         XYVtxIsSignal(univ, sig_def) &&
-         univ.GetThetalepTrue() < sig_def.m_thetamu_max &&
+  const unsigned int n_signal_pions = NSignalPions(univ, sig_def);
+  return univ.GetThetalepTrue() < sig_def.m_thetamu_max &&
          sig_def.m_w_min < univ.GetWexpTrue() &&
          univ.GetWexpTrue() < sig_def.m_w_max &&
-         particles.at("piplus_range") == 1 && Is1PiPlus(particles) &&
          sig_def.m_PmuMinCutVal < univ.GetPmuTrue() &&
          univ.GetPmuTrue() < sig_def.m_PmuMaxCutVal &&
-   //      univ.GetPTmuTrue() < sig_def.m_ptmu_max &&
+         //      univ.GetPTmuTrue() < sig_def.m_ptmu_max &&
          sig_def.m_n_pi_min <= n_signal_pions &&
          n_signal_pions <= sig_def.m_n_pi_max &&
          univ.GetInt("truth_N_pi0") == 0 && univ.GetInt("truth_N_pim") == 0;
@@ -146,4 +146,14 @@ void StackedHistogram<T>::LoadStackedFromFile(TFile& fin,
   }  // loop over components
 }
 
+// Add the component hists of an identically-binned stack to this one
+template <typename T>
+void StackedHistogram<T>::Add(const StackedHistogram& h) {
+  for (auto i : m_hist_map) {
+    auto other = h.m_hist_map.find(i.first);
+    if (other == h.m_hist_map.end() || !other->second) continue;
+    i.second->Add(other->second);
+  }
+}
+
 #endif  // StackedHistogram_cxx
@@ -46,6 +46,7 @@ class StackedHistogram {
   void Initialize();
   PlotUtils::MnvH1D* MakeStackComponentHist(const T type) const;
   void LoadStackedFromFile(TFile& fin, UniverseMap& error_bands);
+  void Add(const StackedHistogram& h);
 };
 
 // Template member functions need to be available in the header.
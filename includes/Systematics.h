@@ -70,6 +70,13 @@ const std::vector<std::string> kGenieSystematics_InteractionModel = {
     "GENIE_D2_NormCCRES",
     "GENIE_MaCCQE"};
 
+// Declare that the universes of bands only shift weight factor (see
+// CVUniverse::GetShiftedWeightFactor)
+void SetShiftedWeightFactor(const UniverseMap& bands, const int factor) {
+  for (const auto& band : bands)
+    for (auto universe : band.second) universe->SetShiftedWeightFactor(factor);
+}
+
 UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
                                       bool is_truth = false,
                                       bool do_full_systematics = false) {
@@ -107,10 +114,13 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
       error_bands[std::string("Target_Mass_CH")].push_back(
           new PlotUtils::TargetMassScintillatorUniverse<CVUniverse>(chain,
                                                                     sigma));
+      error_bands.at("Target_Mass_CH").back()->SetShiftedWeightFactor(
+          CVUniverse::kTargetWgt);
     }
 
     UniverseMap geant_bands =
         PlotUtils::GetGeantHadronSystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(geant_bands, CVUniverse::kGeantWgt);
     error_bands.insert(geant_bands.begin(), geant_bands.end());
 
     //========================================================================
@@ -118,6 +128,7 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
     //========================================================================
     UniverseMap bands_flux = PlotUtils::GetFluxSystematicsMap<CVUniverse>(
         chain, CCNuPionIncConsts::kNFluxUniverses);
+    SetShiftedWeightFactor(bands_flux, CVUniverse::kFluxWgt);
     error_bands.insert(bands_flux.begin(), bands_flux.end());
 
     //========================================================================
@@ -126,17 +137,20 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
     UniverseMap genie_error_bands =
         PlotUtils::GetGenieSystematicsMap<CVUniverse>(
             chain, false);  // Not including the new fitted values
+    SetShiftedWeightFactor(genie_error_bands, CVUniverse::kGenieWgt);
     error_bands.insert(genie_error_bands.begin(), genie_error_bands.end());
 
     // New GENIE MaRES and NormCCRes error bands No Covariance
     UniverseMap new_res_genie_error_bands =
         PlotUtils::GetGenieResPionFitSystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(new_res_genie_error_bands, CVUniverse::kGenieWgt);
     error_bands.insert(new_res_genie_error_bands.begin(),
                        new_res_genie_error_bands.end());
 
     // New GENIE MvRES
     UniverseMap new_ep_genie_error_bands =
         PlotUtils::GetGenieEPMvResSystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(new_ep_genie_error_bands, CVUniverse::kGenieWgt);
     error_bands.insert(new_ep_genie_error_bands.begin(),
                        new_ep_genie_error_bands.end());
 
@@ -145,11 +159,13 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
     //========================================================================
     // RPA
     UniverseMap bands_rpa = PlotUtils::GetRPASystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(bands_rpa, CVUniverse::kRPAWgt);
     error_bands.insert(bands_rpa.begin(), bands_rpa.end());
 
     // 2P2H
     UniverseMap bands_2p2h =
         PlotUtils::Get2p2hSystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(bands_2p2h, CVUniverse::k2p2hWgt);
     error_bands.insert(bands_2p2h.begin(), bands_2p2h.end());
 
     //// LowQ2Pi
@@ -192,6 +208,7 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
     //// MINOS EFFICIENCY
     UniverseMap bands_minoseff =
         PlotUtils::GetMinosEfficiencySystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(bands_minoseff, CVUniverse::kMuEffWgt);
     error_bands.insert(bands_minoseff.begin(), bands_minoseff.end());
 
     UniverseMap muon_res_error_bands =
@@ -214,6 +231,7 @@ UniverseMap GetSystematicUniversesMap(PlotUtils::ChainWrapper* chain,
     //========================================================================
     UniverseMap michel_error_bands =
         PlotUtils::GetMichelEfficiencySystematicsMap<CVUniverse>(chain);
+    SetShiftedWeightFactor(michel_error_bands, CVUniverse::kMichelWgt);
     error_bands.insert(michel_error_bands.begin(), michel_error_bands.end());
 
     //========================================================================
@@ -0,0 +1,155 @@
+#ifndef Timing_h
+#define Timing_h
+
+//==============================================================================
+// Hot-path timing, by stage of the event loop.
+//
+// { timing::ScopedTimer t(timing::kCuts); PassesCuts(...); }
+//
+// Adds the scope's wall time and one call to the stage. Totals are summed over
+// threads. While disabled (the default), a ScopedTimer does nothing but check
+// a bool. Macros call SetEnabledFromEnv, so a run is timed with CCPI_TIMING=1
+// in its environment. End a run with PrintReport, and Write the totals to the output file
+// as the labelled hists "timing_seconds" and "timing_calls".
+//==============================================================================
+#include <atomic>
+#include <chrono>
+#include <cstdlib>  // getenv
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "TFile.h"
+#include "TH1D.h"
+
+namespace timing {
+enum EStage {
+  kEntryRead,
+  kMichelReco,
+  kCuts,
+  kWeight,
+  kFill,
+  kWrite,
+  kNStages
+};
+
+inline std::string GetStageName(const EStage stage) {
+  switch (stage) {
+    case kEntryRead:
+      return "entry_read";
+    case kMichelReco:
+      return "michel_reco";
+    case kCuts:
+      return "cuts";
+    case kWeight:
+      return "weight";
+    case kFill:
+      return "fill";
+    case kWrite:
+      return "write";
+    default:
+      return "unknown";
+  }
+}
+
+// Totals, in ns and calls, per stage
+struct StageTotals {
+  std::atomic<bool> enabled{false};
+  std::atomic<long long> ns[kNStages];
+  std::atomic<long long> calls[kNStages];
+  StageTotals() {
+    for (int i = 0; i < kNStages; ++i) {
+      ns[i] = 0;
+      calls[i] = 0;
+    }
+  }
+};
+
+inline StageTotals& Totals() {
+  static StageTotals totals;
+  return totals;
+}
+
+inline void SetEnabled(const bool enabled) { Totals().enabled = enabled; }
+
+// Enabled iff $CCPI_TIMING is set, and not to 0
+inline void SetEnabledFromEnv() {
+  const char* env = std::getenv("CCPI_TIMING");
+  SetEnabled(env && std::string(env) != "0");
+}
+inline bool IsEnabled() {
+  return Totals().enabled.load(std::memory_order_relaxed);
+}
+
+inline double GetSeconds(const EStage stage) {
+  return Totals().ns[stage] * 1.e-9;
+}
+inline long long GetCalls(const EStage stage) { return Totals().calls[stage]; }
+
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(const EStage stage)
+      : m_stage(stage), m_enabled(IsEnabled()) {
+    if (m_enabled) m_start = std::chrono::steady_clock::now();
+  }
+  ~ScopedTimer() {
+    if (!m_enabled) return;
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - m_start)
+                        .count();
+    Totals().ns[m_stage].fetch_add(ns, std::memory_order_relaxed);
+    Totals().calls[m_stage].fetch_add(1, std::memory_order_relaxed);
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  const EStage m_stage;
+  const bool m_enabled;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+inline void PrintReport(std::ostream& os = std::cout) {
+  if (!IsEnabled()) return;
+  double total = 0.;
+  for (int i = 0; i < kNStages; ++i) total += GetSeconds(EStage(i));
+  os << "\n== Time by stage (summed over threads) ==\n";
+  os << std::left << std::setw(14) << "stage" << std::right << std::setw(12)
+     << "sec" << std::setw(8) << "%" << std::setw(14) << "calls"
+     << std::setw(12) << "us/call"
+     << "\n";
+  for (int i = 0; i < kNStages; ++i) {
+    const EStage stage = EStage(i);
+    const double sec = GetSeconds(stage);
+    const long long calls = GetCalls(stage);
+    os << std::left << std::setw(14) << GetStageName(stage) << std::right
+       << std::fixed << std::setprecision(2) << std::setw(12) << sec
+       << std::setw(8) << (total > 0. ? 100. * sec / total : 0.)
+       << std::setw(14) << calls << std::setw(12)
+       << (calls > 0 ? 1.e6 * sec / calls : 0.) << "\n";
+  }
+  os << std::defaultfloat;
+}
+
+// tag is appended to the hist names, for files that collect more than one
+// macro's timing.
+inline void Write(TFile& fout, const std::string& tag = "") {
+  if (!IsEnabled()) return;
+  fout.cd();
+  TH1D h_sec(("timing_seconds" + tag).c_str(), "Time by stage;;sec", kNStages,
+             0., kNStages);
+  TH1D h_calls(("timing_calls" + tag).c_str(), "Calls by stage;;calls",
+               kNStages, 0., kNStages);
+  for (int i = 0; i < kNStages; ++i) {
+    const EStage stage = EStage(i);
+    h_sec.GetXaxis()->SetBinLabel(i + 1, GetStageName(stage).c_str());
+    h_calls.GetXaxis()->SetBinLabel(i + 1, GetStageName(stage).c_str());
+    h_sec.SetBinContent(i + 1, GetSeconds(stage));
+    h_calls.SetBinContent(i + 1, GetCalls(stage));
+  }
+  h_sec.Write();
+  h_calls.Write();
+}
+}  // namespace timing
+
+#endif  // Timing_h
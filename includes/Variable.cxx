@@ -44,14 +44,16 @@ double Variable::GetValue(const CVUniverse& universe,
 
 // Histogram Initialization
 template <typename T>
-void Variable::InitializeAllHists(T systematic_univs,
-                                  T systematic_univs_truth) {
-  m_hists.InitializeAllHists(systematic_univs, systematic_univs_truth);
+void Variable::InitializeAllHists(T systematic_univs, T systematic_univs_truth,
+                                  const bool flat_storage, const int families) {
+  m_hists.InitializeAllHists(systematic_univs, systematic_univs_truth,
+                             flat_storage, families);
 }
 
 template <typename T>
-void Variable::InitializeSidebandHists(T systematic_univs) {
-  m_hists.InitializeSidebandHists(systematic_univs);
+void Variable::InitializeSidebandHists(T systematic_univs,
+                                       const bool flat_storage) {
+  m_hists.InitializeSidebandHists(systematic_univs, flat_storage);
 }
 
 void Variable::InitializeStackedHists() { m_hists.InitializeStackedHists(); }
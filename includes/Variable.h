@@ -29,6 +29,8 @@ class Variable {
            PointerToCVUniverseFunction p = &CVUniverse::GetDummyVar,
            const bool is_true = false);
 
+  virtual ~Variable() {}
+
   //==========================================================================
   // Data members
   //==========================================================================
@@ -53,9 +55,12 @@ class Variable {
 
   // Histogram Initialization
   template <typename T>
-  void InitializeAllHists(T systematic_univs, T systematic_univs_truth);
+  void InitializeAllHists(T systematic_univs, T systematic_univs_truth,
+                          const bool flat_storage = false,
+                          const int families = kAllHistFamilies);
   template <typename T>
-  void InitializeSidebandHists(T systematic_univs);
+  void InitializeSidebandHists(T systematic_univs,
+                               const bool flat_storage = false);
   void InitializeStackedHists();
   void InitializeDataHists();
 
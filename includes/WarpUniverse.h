@@ -0,0 +1,181 @@
+#ifndef WarpUniverse_h
+#define WarpUniverse_h
+
+//==============================================================================
+// Warped pseudo-universes, for warping studies.
+//
+// A warp reweights the MC (see CVUniverse::WeightConfig). It doesn't change
+// the selection or the fill values, so instead of a macro run per warp, each
+// warp gets a vertical error band of one universe, Warp_<name>, which is
+// filled with the CV's event in the same loop as everything else.
+//
+// Before the hists are written, WriteWarpHists takes the warp bands out of
+// them and writes each warp's universe, under the hist's own name, to a file
+// of its own: <output>_<name>.root. These are the NOMINAL, WARP1, ... inputs
+// of runTransWarp.sh.
+//==============================================================================
+#include <cstdlib>  // exit
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CVUniverse.h"
+#include "Constants.h"  // typedef UniverseMap
+#include "PlotUtils/ChainWrapper.h"
+#include "TFile.h"
+#include "Variable.h"
+
+namespace warp {
+const std::string kBandPrefix = "Warp_";
+
+// Weights of the named warp
+inline CVUniverse::WeightConfig GetWeightConfig(const std::string& name) {
+  CVUniverse::WeightConfig config;
+  if (name == "NOMINAL") return config;
+  if (name == "WARP1")
+    config.genie_warp = true;
+  else if (name == "WARP2")
+    config.aniso_warp = true;
+  else if (name == "WARP3")
+    config.mk_warp = true;
+  else if (name == "WARP4")
+    config.maresfrac_warp = true;
+  else if (name == "WARP5")
+    config.tpi_warp = true;
+  else if (name == "CLOSURE")
+    config.closure_test = true;
+  else {
+    std::cerr << "warp::GetWeightConfig: unknown warp " << name
+              << ". Known: NOMINAL, WARP1-5, CLOSURE.\n";
+    std::exit(1);
+  }
+  return config;
+}
+
+class WarpUniverse : public CVUniverse {
+ public:
+  WarpUniverse(PlotUtils::ChainWrapper* chw, const std::string& name)
+      : CVUniverse(chw), m_name(name), m_config(GetWeightConfig(name)) {}
+
+  const std::string& WarpName() const { return m_name; }
+
+  virtual double GetWeight() const /*override*/ {
+    return MultiplyWeightFactors(GetWeightFactors(m_config));
+  }
+
+  virtual std::string ShortName() const /*override*/ {
+    return kBandPrefix + m_name;
+  }
+  virtual std::string LatexName() const /*override*/ {
+    return "Warp " + m_name;
+  }
+  virtual bool IsVerticalOnly() const /*override*/ { return true; }
+
+ private:
+  std::string m_name;
+  CVUniverse::WeightConfig m_config;
+};
+
+// The comma-separated warp names, e.g. "NOMINAL,WARP2,WARP3"
+inline std::vector<std::string> GetWarpNames(const std::string& names) {
+  std::vector<std::string> ret;
+  std::stringstream ss(names);
+  std::string name;
+  while (std::getline(ss, name, ',')) {
+    if (name.empty()) continue;
+    GetWeightConfig(name);  // exits if unknown
+    for (const auto& other : ret) {
+      if (other == name) {
+        std::cerr << "warp::GetWarpNames: " << name << " listed twice\n";
+        std::exit(1);
+      }
+    }
+    ret.push_back(name);
+  }
+  return ret;
+}
+
+// The names of error_bands' warps
+inline std::vector<std::string> GetWarpNames(const UniverseMap& error_bands) {
+  std::vector<std::string> ret;
+  for (const auto& band : error_bands)
+    if (band.first.compare(0, kBandPrefix.size(), kBandPrefix) == 0)
+      ret.push_back(band.first.substr(kBandPrefix.size()));
+  return ret;
+}
+
+// Give each warp a one-universe band in error_bands
+inline void AddWarpUniverses(UniverseMap& error_bands,
+                             PlotUtils::ChainWrapper* chain,
+                             const std::vector<std::string>& names) {
+  for (const auto& name : names)
+    error_bands[kBandPrefix + name].push_back(new WarpUniverse(chain, name));
+}
+
+// Take band out of hist, and return its universe as a hist of its own, with
+// hist's name. nullptr if hist doesn't have band.
+template <class MH>
+MH* PopWarp(MH* hist, const std::string& band) {
+  if (!hist || !hist->HasVertErrorBand(band)) return nullptr;
+  auto error_band = hist->PopVertErrorBand(band);
+  MH* ret = new MH(*error_band->GetHist(0));
+  ret->SetName(hist->GetName());
+  delete error_band;
+  return ret;
+}
+
+// Output file of a warp, next to the macro's output
+inline std::string GetWarpFilename(const std::string& outfile_name,
+                                   const std::string& name) {
+  const std::string ext = ".root";
+  std::string stem = outfile_name;
+  if (stem.size() > ext.size() &&
+      stem.compare(stem.size() - ext.size(), ext.size(), ext) == 0)
+    stem.erase(stem.size() - ext.size());
+  return stem + "_" + name + ext;
+}
+
+// Move v's warp bands out of its MC hists, into the warps' files. Call after
+// the hists are synced and before v.WriteMCHists.
+inline void WriteWarpHists(Variable& v,
+                           const std::map<std::string, TFile*>& warp_files) {
+  Histograms& h = v.m_hists;
+  const std::vector<PlotUtils::MnvH1D*> hists = {
+      h.m_selection_mc.hist,
+      h.m_selection_mc_tracked.hist,
+      h.m_selection_mc_untracked.hist,
+      h.m_selection_mc_mixed.hist,
+      h.m_selection_mc_no_tpi_weight.hist,
+      h.m_selection_mc_tracked_no_tpi_weight.hist,
+      h.m_selection_mc_untracked_no_tpi_weight.hist,
+      h.m_selection_mc_mixed_no_tpi_weight.hist,
+      h.m_bg.hist,
+      h.m_bg_loW.hist,
+      h.m_bg_midW.hist,
+      h.m_bg_hiW.hist,
+      h.m_effnum.hist,
+      h.m_effden.hist,
+      h.m_wsidebandfit_sig.hist,
+      h.m_wsidebandfit_loW.hist,
+      h.m_wsidebandfit_midW.hist,
+      h.m_wsidebandfit_hiW.hist};
+  for (const auto& warp_file : warp_files) {
+    const std::string band = kBandPrefix + warp_file.first;
+    warp_file.second->cd();
+    for (auto hist : hists) {
+      if (PlotUtils::MnvH1D* warped = PopWarp(hist, band)) {
+        warped->Write();
+        delete warped;
+      }
+    }
+    if (PlotUtils::MnvH2D* warped = PopWarp(h.m_migration.hist, band)) {
+      warped->Write();
+      delete warped;
+    }
+  }
+}
+}  // namespace warp
+
+#endif  // WarpUniverse_h
@@ -2,12 +2,14 @@
 #define common_functions_h
 
 #include <algorithm>  // erase, remove_if
+#include <cstdlib>    // atof, exit
 
 #include "Constants.h"  // CCNuPionIncConsts::PI
 #include "MacroUtil.h"
 #include "PlotUtils/MnvH1D.h"
 #include "TFile.h"
 #include "TKey.h"
+#include "TSystem.h"  // gSystem
 #include "Variable.h"
 
 class Variable;
@@ -131,4 +133,32 @@ Variable* GetVar(std::vector<Variable*> variables, std::string name) {
   }
 }
 
+// Print each variable's (and the total) approximate hist memory. Returns the
+// total.
+double PrintHistMemoryEstimate(const std::vector<Variable*>& variables) {
+  std::cout << "Hist memory estimate (MB)\n";
+  double total = 0.;
+  for (auto v : variables) {
+    const double mb = v->m_hists.GetMemoryEstimateMB();
+    std::cout << "  " << v->Name() << " " << mb << "\n";
+    total += mb;
+  }
+  std::cout << "  total " << total << "\n\n";
+  return total;
+}
+
+// Exit if n_copies of hists of hist_mb won't fit in the job's memory request,
+// $CCPI_MEMORY_MB (ProcessCCPiMacro.py sets it). Better than being killed
+// partway through the loop. Without the variable, there's nothing to check.
+void CheckHistMemory(const double hist_mb, const int n_copies) {
+  const char* request = gSystem->Getenv("CCPI_MEMORY_MB");
+  if (!request) return;
+  const double request_mb = std::atof(request);
+  if (hist_mb * n_copies <= request_mb) return;
+  std::cerr << "CheckHistMemory: " << n_copies << " copies of the hists need ~"
+            << hist_mb * n_copies << " MB, more than the " << request_mb
+            << " MB requested. Use fewer threads or request more memory.\n";
+  std::exit(1);
+}
+
 #endif  // common_functions_h
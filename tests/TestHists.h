@@ -0,0 +1,88 @@
+#ifndef TestHists_h
+#define TestHists_h
+
+//==============================================================================
+// Shared pieces of the tests' hists: made-up fills of every universe, and a
+// bin-by-bin compare.
+//==============================================================================
+#include <algorithm>  // max
+#include <cmath>      // fabs
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "includes/CVUniverse.h"
+#include "includes/Constants.h"  // UniverseMap
+#include "includes/CounterRNG.h"
+#include "includes/Histograms.h"
+#include "TH1.h"
+
+namespace test_hists {
+// Made-up fills go to hists of kNBins bins on [kXMin, kXMax)
+const int kNFills = 10000;
+const int kNBins = 10;
+const double kXMin = 0.;
+const double kXMax = 10.;
+
+// A FlatHW of the test binning over error_bands
+inline FlatHW* MakeFlatHW(const std::string& name,
+                          const UniverseMap& error_bands,
+                          const bool flat_storage) {
+  MH1D* base = new MH1D(name.c_str(), "", kNBins, kXMin, kXMax);
+  const bool clear_bands = true;
+  FlatHW* hw = new FlatHW(base, error_bands, clear_bands, flat_storage);
+  delete base;
+  return hw;
+}
+
+// Call fill(universe, i, value, weight) kNFills times for every universe of
+// error_bands, with made-up values (some under- and overflow too) and weights
+// in [0, 2). The same stream gives the same fills.
+template <class F>
+void ForEachFakeFill(const UniverseMap& error_bands, const uint64_t stream,
+                     F fill) {
+  uint64_t i_universe = 0;
+  for (const auto& band : error_bands) {
+    for (const CVUniverse* universe : band.second) {
+      ++i_universe;
+      for (int i = 0; i < kNFills; ++i) {
+        const uint64_t key = counter_rng::Mix(i_universe) ^ uint64_t(i);
+        const double value =
+            kXMin - 1. + (kXMax - kXMin + 2.) *
+                             counter_rng::Uniform(key, 2 * stream);
+        const double weight = 2. * counter_rng::Uniform(key, 2 * stream + 1);
+        fill(*universe, i, value, weight);
+      }
+    }
+  }
+}
+
+// Number of bins (under/overflow included) of a and b that differ: contents
+// always, errors if check_errors. By more than tolerance, relative to the
+// larger of the two bins (or absolute, below 1). 0 is bit-for-bit.
+inline int CompareBins(const TH1* a, const TH1* b, const double tolerance,
+                       const std::string& name,
+                       const bool check_errors = true) {
+  if (a->GetNcells() != b->GetNcells()) {
+    std::cout << name << ": " << a->GetNcells() << " vs " << b->GetNcells()
+              << " bins\n";
+    return 1;
+  }
+  int n_diffs = 0;
+  for (int bin = 0; bin < a->GetNcells(); ++bin) {
+    for (const bool error : {false, true}) {
+      if (error && !check_errors) continue;
+      const double x = error ? a->GetBinError(bin) : a->GetBinContent(bin);
+      const double y = error ? b->GetBinError(bin) : b->GetBinContent(bin);
+      const double scale = std::max({std::fabs(x), std::fabs(y), 1.});
+      if (std::fabs(x - y) <= tolerance * scale) continue;
+      if (n_diffs++ < 5)
+        std::cout << name << " bin " << bin << (error ? " error " : " ")
+                  << x << " vs " << y << "\n";
+    }
+  }
+  return n_diffs;
+}
+}  // namespace test_hists
+
+#endif  // TestHists_h
@@ -0,0 +1,78 @@
+#!/bin/bash
+
+# Check that the threaded event loops fill the same hists as the serial ones.
+#
+# Runs makeCrossSectionMCInputs on one MC tuple with 1 thread and with
+# N_THREADS threads, entry-split and universe-split, and compares the outputs
+# with compareXSecInputs.C: every bin of every universe must agree to
+# TOLERANCE (relative). The sums only differ in the order that the threads'
+# shards are added, so anything past rounding is a bug.
+#
+# The truth loop runs threaded too, right after each threaded reco loop has
+# deleted its shards' chains. Its hists (effden) are also compared on their
+# own, so that a truth loop reading through a reco clone's stale branches
+# (see GetBranchRegistry) shows up by name.
+#
+# Usage, from the top of the repo:
+#   tests/runThreadCheck.sh mc_tuple.root [N_THREADS] [TOLERANCE] [DATA_PLAYLIST]
+# With systematics on, so that the lateral (including track angle smearing),
+# warp, and bootstrap universes are all checked.
+#
+# With DATA_PLAYLIST, crossSectionDataFromFile's data loop is checked the same
+# way, 1 thread vs N_THREADS. It reads its MC inputs file from the working
+# directory, as it always does.
+
+MC_FILE=$1
+N_THREADS=${2:-4}
+TOLERANCE=${3:-1e-9}
+DATA_PLAYLIST=$4
+if [ -z "${MC_FILE}" ]; then
+  echo "Usage: $0 mc_tuple.root [N_THREADS] [TOLERANCE] [DATA_PLAYLIST]"
+  exit 1
+fi
+
+SIGNAL_DEFINITION=0
+PLAYLIST=ME1A
+RUN=0
+OUTDIR=$(mktemp -d)
+STATUS=0
+
+# $1: n_threads, $2: split_universes, $3: output name
+function RunMCInputs {
+  LOG=${OUTDIR}/$3.log
+  root.exe -b -q -l loadLibs.C+ "xsec/makeCrossSectionMCInputs.C+(${SIGNAL_DEFINITION},\"${PLAYLIST}\",true,true,false,false,\"${MC_FILE}\",${RUN},$1,\"\",false,$2,\"\",false,\"\",\"\",\"NOMINAL,WARP1\",20)" > ${LOG} 2>&1 || { tail ${LOG}; exit 1; }
+  OUTFILE=$(grep -m1 "Saving output to" ${LOG} | awk '{print $4}')
+  mv ${OUTFILE} ${OUTDIR}/$3
+  rm -f ${OUTFILE%.root}_NOMINAL.root ${OUTFILE%.root}_WARP1.root
+}
+
+# $1: n_threads, $2: output name
+function RunData {
+  LOG=${OUTDIR}/$2.log
+  root.exe -b -q -l loadLibs.C+ "xsec/crossSectionDataFromFile.C+(${SIGNAL_DEFINITION},\"${DATA_PLAYLIST}\",false,\"\",false,$1)" > ${LOG} 2>&1 || { tail ${LOG}; exit 1; }
+  OUTFILE=$(grep -m1 "Output file is" ${LOG} | awk '{print $4}')
+  mv ${OUTFILE} ${OUTDIR}/$2
+}
+
+# $1: description, $2 and $3: output names, $4: optional hist name filter
+function Compare {
+  echo "======== $1 ========"
+  root.exe -b -q -l loadLibs.C+ "tests/compareXSecInputs.C+(\"${OUTDIR}/$2\",\"${OUTDIR}/$3\",${TOLERANCE},\"$4\")" || STATUS=1
+}
+
+RunMCInputs 1 false serial.root
+RunMCInputs ${N_THREADS} false entries.root
+RunMCInputs ${N_THREADS} true universes.root
+for SPLIT in entries universes; do
+  Compare "1 thread vs ${N_THREADS} threads, ${SPLIT} split" serial.root ${SPLIT}.root
+  Compare "truth, 1 thread vs ${N_THREADS} threads, after the ${SPLIT} split reco loop" serial.root ${SPLIT}.root effden
+done
+
+if [ -n "${DATA_PLAYLIST}" ]; then
+  RunData 1 data_serial.root
+  RunData ${N_THREADS} data_threads.root
+  Compare "data, 1 thread vs ${N_THREADS} threads" data_serial.root data_threads.root
+fi
+
+rm -r ${OUTDIR}
+exit ${STATUS}
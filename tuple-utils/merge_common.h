@@ -13,7 +13,9 @@
 #include "PlotUtils/MacroUtil.cxx"
 
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <vector>
 #include <cassert>
 
 //======================================================================
@@ -100,9 +102,41 @@ double getResurrectionMCFilePOT(const char* filename)
 }
 
 
-void setBranchStatuses(TChain& ch)
+//======================================================================
+// Read a list file: one entry per line, '#' starts a comment
+std::vector<std::string> readLines(const char* filename)
+{
+  std::vector<std::string> lines;
+  if(!filename || std::string(filename).empty()) return lines;
+  std::ifstream in(filename);
+  if(!in.good()){
+    std::cout << "Can't open " << filename << std::endl;
+    std::exit(1);
+  }
+  std::string line;
+  while(std::getline(in, line)){
+    line=line.substr(0, line.find('#'));
+    line.erase(0, line.find_first_not_of(" \t"));
+    line.erase(line.find_last_not_of(" \t\r")+1);
+    if(!line.empty()) lines.push_back(line);
+  }
+  return lines;
+}
+
+//======================================================================
+// Keep only the branches in branchListFile (wildcards allowed). Such a list
+// can be recorded from an analysis run with RecordReadBranches in
+// includes/MacroUtil.h.
+void setBranchStatuses(TChain& ch, const char* branchListFile="")
 {
-  // In latest ntuples, there aren't any really useless branches, so we'll just keep everything
+  // In latest ntuples, there aren't any really useless branches, so by default
+  // we'll just keep everything
+  const std::vector<std::string> branches=readLines(branchListFile);
+  if(branches.empty()) return;
+
+  std::cout << "Keeping " << branches.size() << " branches of " << ch.GetName() << std::endl;
+  ch.SetBranchStatus("*", 0);
+  for(const auto& b : branches) ch.SetBranchStatus(b.c_str(), 1);
   return;
 
   // cout << "Setting branch statuses" << endl;
@@ -9,6 +9,7 @@
 #include "TH1.h"
 #include "TH2.h"
 #include "TVector3.h"
+#include "../includes/ParticleTopology.h"
 typedef unsigned int uint;
 
 class MinModDepCCQEXSec : public XSec {
@@ -24,126 +25,6 @@ class MinModDepCCQEXSec : public XSec {
     return pmuVec;
   }
 
-  bool Is1PiPlus(const std::map<std::string, int>& particles) {
-    TString counted_signal("muons piplus piplus_range pions mesons");
-    TString any_baryon("protons neutrons nucleons heavy_baryons nuclei");
-    int n_bg = 0;
-    for (auto p : particles) {
-      std::string particle = p.first;
-      int count = p.second;
-      if (counted_signal.Contains(particle) || any_baryon.Contains(particle))
-        continue;
-      n_bg += count;
-    }
-    if (particles.at("muons") == 1 && particles.at("piplus") == 1 &&
-        particles.at("pions") == particles.at("piplus") &&
-        particles.at("mesons") == particles.at("piplus") && n_bg == 0)
-      return true;  // any number of baryons, nothing else
-
-    return false;
-  }
-
-  std::map<string, int> GetParticleTopology(
-      const std::vector<int>& FS_PDG, const std::vector<double>& FS_energy) {
-    std::map<std::string, int> genie_n;
-
-    // Overarching categories: nucleons, mesons
-    genie_n["muons"] = 0;     // Muons, photons (do we want electrons...)
-    genie_n["photons"] = 0;   // Photons are filled if there are electrons
-    genie_n["pi_zeros"] = 0;  // Pions
-    genie_n["piplus"] = 0;
-    genie_n["piplus_range"] = 0;  // Pi+ that passes the kinematic cuts
-    genie_n["piminus"] = 0;
-    genie_n["pions"] = 0;
-    genie_n["kaons"] = 0;  // Other mesons
-    genie_n["charms"] = 0;
-    genie_n["mesons"] = 0;
-    genie_n["protons"] = 0;  // Baryons
-    genie_n["neutrons"] = 0;
-    genie_n["nucleons"] = 0;
-    genie_n["heavy_baryons"] = 0;
-    genie_n["nuclei"] = 0;
-    genie_n["others"] = 0;  // others
-
-    double tpi = 0;
-    for (uint p = 0; p < FS_PDG.size(); p++) {
-      // Get tpi
-      tpi = (FS_energy[p] - 139.569);
-
-      // Look at every particle's pdg
-      switch (FS_PDG[p]) {
-        case 13:
-          genie_n["muons"]++;
-          break;
-        case 22:
-          // Check the energy.  If below 10 MeV, it's a nuclear deexcitation,
-          // which we ignore
-          if (FS_energy[p] > 10) genie_n["photons"]++;
-          break;
-        case 11:
-        case -11:
-          genie_n["photons"]++;
-          break;
-        case 211:
-          if ( 35.< tpi && tpi < 350.) genie_n["piplus_range"]++;
-          genie_n["piplus"]++;
-          genie_n["pions"]++;
-          genie_n["mesons"]++;
-          break;
-        case -211:
-          genie_n["piminus"]++;
-          genie_n["pions"]++;
-          genie_n["mesons"]++;
-          break;
-        case 111:
-          genie_n["pi_zeros"]++;
-          // genie_n["photons"]++;
-          genie_n["pions"]++;
-          genie_n["mesons"]++;
-          break;
-        case 130:
-        case 310:
-        case 311:
-        case 321:
-        case -130:
-        case -310:
-        case -311:
-        case -321:
-          genie_n["kaons"]++;
-          genie_n["mesons"]++;
-          break;
-        case 411:
-        case 421:
-        case 431:
-        case -411:
-        case -421:
-        case -431:
-          genie_n["charms"]++;
-          genie_n["mesons"]++;
-          break;
-        case 2212:
-          genie_n["protons"]++;
-          genie_n["nucleons"]++;
-          break;
-        case 2112:
-          genie_n["neutrons"]++;
-          genie_n["nucleons"]++;
-          break;
-        case 2000000101:  // bindino is binding energy placeholder
-          break;
-        default:
-          if (FS_PDG[p] > 3000 && FS_PDG[p] < 5000)
-            genie_n["heavy_baryons"]++;
-          else if (FS_PDG[p] > 1000000000 && FS_PDG[p] < 1099999999)
-            genie_n["nuclei"]++;
-          else
-            genie_n["others"]++;
-      }
-    }
-
-    return genie_n;
-  }
-
   double thetamudegrees(ChainWrapper& chw,
                         int entry) {  // it returns the value
                                       // of thetamu in degrees
@@ -349,8 +230,8 @@ class MinModDepCCQEXSec : public XSec {
   // include in this selection
   virtual bool passesCuts(ChainWrapper& chw, int entry) {
     int pionIdx = GetHighestpionEnergyIdx(chw, entry);
-    std::map<std::string, int> particles =
-        GetParticleTopology(FSPDGvector(chw, entry), FSEvector(chw, entry));
+    const topology::ParticleTopology particles = topology::GetParticleTopology(
+        FSPDGvector(chw, entry), FSEvector(chw, entry), 35., 350., 139.569);
     double pmu = GetPmu(chw, entry);
     double Wexp = GetWexpTrue(chw, entry);
     int Npions = NSignalPions(chw, entry);
@@ -363,8 +244,8 @@ class MinModDepCCQEXSec : public XSec {
     if (Wexp > 1.4) return false;
     //    if (Npions != 1) return false;
     //    if (NOtherParticles(chw, entry) > 0) return false;
-    if (particles.at("piplus_range") != 1) return false;
-    if (!Is1PiPlus(particles)) return false;
+    if (particles[topology::kPiPlusRange] != 1) return false;
+    if (!topology::Is1PiPlus(particles)) return false;
     if (pmu < 1.5) return false;
     if (pmu > 20.) return false;
     //  if (chw.GetValue("truth_N_pi0", entry) != 0) return false;